@@ -26,15 +26,17 @@
 #include "utils.hpp"
 
 template <typename scalar_t>
-std::string get_name(int size) {
+std::string get_name(int size, blas::Accuracy accuracy) {
   std::ostringstream str{};
   str << "BM_Asum<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/";
-  str << size;
+  str << size << "/";
+  str << blas_benchmark::utils::get_accuracy_name(accuracy);
   return str.str();
 }
 
 template <typename scalar_t>
-void run(benchmark::State& state, ExecutorType* executorPtr, index_t size) {
+void run(benchmark::State& state, ExecutorType* executorPtr, index_t size,
+         blas::Accuracy accuracy) {
   // Google-benchmark counters are double.
   double size_d = static_cast<double>(size);
   state.counters["size"] = size_d;
@@ -52,7 +54,7 @@ void run(benchmark::State& state, ExecutorType* executorPtr, index_t size) {
 
   // Warmup
   for (int i = 0; i < 10; i++) {
-    _asum(ex, size, inx, 1, inr);
+    _asum(ex, size, inx, 1, inr, accuracy);
   }
   ex.get_policy_handler().wait();
 
@@ -63,7 +65,7 @@ void run(benchmark::State& state, ExecutorType* executorPtr, index_t size) {
     // Run
     std::tuple<double, double> times =
         blas_benchmark::utils::timef([&]() -> std::vector<cl::sycl::event> {
-          auto event = _asum(ex, size, inx, 1, inr);
+          auto event = _asum(ex, size, inx, 1, inr, accuracy);
           ex.get_policy_handler().wait(event);
           return event;
         });
@@ -80,10 +82,14 @@ void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr) {
   auto gemm_params = blas_benchmark::utils::get_blas1_params(args);
 
   for (auto size : gemm_params) {
-    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
-                         index_t size) { run<scalar_t>(st, exPtr, size); };
-    benchmark::RegisterBenchmark(get_name<scalar_t>(size).c_str(), BM_lambda,
-                                 exPtr, size);
+    for (auto accuracy : blas_benchmark::utils::accuracy_modes) {
+      auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                           index_t size, blas::Accuracy accuracy) {
+        run<scalar_t>(st, exPtr, size, accuracy);
+      };
+      benchmark::RegisterBenchmark(get_name<scalar_t>(size, accuracy).c_str(),
+                                   BM_lambda, exPtr, size, accuracy);
+    }
   }
 }
 
@@ -0,0 +1,106 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename scal_host_overhead.cpp
+ *
+ **************************************************************************/
+#include "utils.hpp"
+
+#include <chrono>
+
+template <typename scalar_t>
+std::string get_name(int size) {
+  std::ostringstream str{};
+  str << "BM_ScalHostOverhead<"
+      << blas_benchmark::utils::get_type_name<scalar_t>() << ">/";
+  str << size;
+  return str.str();
+}
+
+/*!
+ * Measures the host side of one call on a small vector allocated through the
+ * policy handler: resolving the pointers, building the tree and submitting
+ * the kernel. The wait for the kernel is not timed.
+ */
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, index_t size) {
+  state.counters["size"] = static_cast<double>(size);
+
+  ExecutorType& ex = *executorPtr;
+  auto policy_handler = ex.get_policy_handler();
+
+  // Create data
+  std::vector<scalar_t> v1 = blas_benchmark::utils::random_data<scalar_t>(size);
+  scalar_t alpha = blas_benchmark::utils::random_scalar<scalar_t>();
+
+  auto in = policy_handler.template allocate<scalar_t>(size);
+  policy_handler.wait(policy_handler.copy_to_device(v1.data(), in, size));
+
+  // Warmup
+  for (int i = 0; i < 10; i++) {
+    _scal(ex, size, alpha, in, 1);
+  }
+  policy_handler.wait();
+
+  state.counters["total_host_time"] = 0;
+  state.counters["best_host_time"] = ULONG_MAX;
+
+  // Measure
+  for (auto _ : state) {
+    auto start = std::chrono::steady_clock::now();
+    auto event = _scal(ex, size, alpha, in, 1);
+    auto end = std::chrono::steady_clock::now();
+
+    state.PauseTiming();
+    policy_handler.wait(event);
+    double host_time =
+        std::chrono::duration<double, std::nano>(end - start).count();
+    state.counters["total_host_time"] += host_time;
+    state.counters["best_host_time"] =
+        std::min<double>(state.counters["best_host_time"], host_time);
+    state.ResumeTiming();
+  };
+
+  state.counters["avg_host_time"] =
+      state.counters["total_host_time"] / state.iterations();
+
+  policy_handler.template deallocate<scalar_t>(in);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr) {
+  // Small vectors, where the host work is a large share of the call
+  for (index_t size : {1, 64, 1024}) {
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                         index_t size) { run<scalar_t>(st, exPtr, size); };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(size).c_str(), BM_lambda,
+                                 exPtr, size);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr) {
+  register_benchmark<float>(args, exPtr);
+#ifdef DOUBLE_SUPPORT
+  register_benchmark<double>(args, exPtr);
+#endif
+}
+}  // namespace blas_benchmark
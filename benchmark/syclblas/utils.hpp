@@ -37,6 +37,30 @@ inline cl_ulong time_event<cl::sycl::event>(cl::sycl::event& e) {
   return (end_time - start_time);
 }
 
+/**
+ * @fn get_accuracy_name
+ * @brief Returns a string with the name of the given reduction accuracy mode.
+ */
+inline std::string get_accuracy_name(blas::Accuracy accuracy) {
+  switch (accuracy) {
+    case blas::Accuracy::compensated:
+      return "compensated";
+    case blas::Accuracy::pairwise:
+      return "pairwise";
+    case blas::Accuracy::wide:
+      return "wide";
+    default:
+      return "standard";
+  }
+}
+
+/**
+ * @brief The reduction accuracy modes benchmarked for dot and asum.
+ */
+static const blas::Accuracy accuracy_modes[] = {
+    blas::Accuracy::standard, blas::Accuracy::compensated,
+    blas::Accuracy::pairwise, blas::Accuracy::wide};
+
 }  // namespace utils
 }  // namespace blas_benchmark
 
@@ -387,12 +387,37 @@ add_library(${LIB_NAME} ${LIB_TYPE}
                              $<TARGET_OBJECTS:rot>
                              $<TARGET_OBJECTS:scal>
                              $<TARGET_OBJECTS:swap>
+                             $<TARGET_OBJECTS:dot_async>
+                             $<TARGET_OBJECTS:asum_async>
+                             $<TARGET_OBJECTS:nrm2_async>
+                             $<TARGET_OBJECTS:iamax_async>
+                             $<TARGET_OBJECTS:iamin_async>
+                             $<TARGET_OBJECTS:axpy_batched>
+                             $<TARGET_OBJECTS:scal_batched>
+                             $<TARGET_OBJECTS:dot_batched>
+                             $<TARGET_OBJECTS:nrm2_batched>
+                             $<TARGET_OBJECTS:axpby>
+                             $<TARGET_OBJECTS:waxpby>
+                             $<TARGET_OBJECTS:axpy_dot>
+                             $<TARGET_OBJECTS:scal_copy>
+                             $<TARGET_OBJECTS:rotm>
+                             $<TARGET_OBJECTS:rotmg>
+                             $<TARGET_OBJECTS:rot_batched>
                              $<TARGET_OBJECTS:gemv>
+                             $<TARGET_OBJECTS:gemv_batched>
+                             $<TARGET_OBJECTS:gemv_multi_vector>
                              $<TARGET_OBJECTS:ger>
                              $<TARGET_OBJECTS:symv>
                              $<TARGET_OBJECTS:syr>
                              $<TARGET_OBJECTS:syr2>
                              $<TARGET_OBJECTS:trmv>
+                             $<TARGET_OBJECTS:trsv>
+                             $<TARGET_OBJECTS:gbmv>
+                             $<TARGET_OBJECTS:sbmv>
+                             $<TARGET_OBJECTS:tbmv>
+                             $<TARGET_OBJECTS:spmv>
+                             $<TARGET_OBJECTS:tpmv>
+                             $<TARGET_OBJECTS:spr>
                              $<TARGET_OBJECTS:gemm_launcher>
                              $<TARGET_OBJECTS:gemm>
                             )
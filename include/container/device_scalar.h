@@ -0,0 +1,93 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename device_scalar.h
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_DEVICE_SCALAR_H
+#define SYCL_BLAS_DEVICE_SCALAR_H
+#include "blas_meta.h"
+#include "container/blas_iterator.h"
+
+namespace blas {
+
+/*!
+ * @brief A scalar result that still lives on the device.
+ *
+ * Returned by the asynchronous variants of the scalar-returning BLAS1
+ * routines (e.g. _dot_async). It holds the one-element buffer the result is
+ * written to and the events of the kernels producing it, so the host only
+ * blocks when it explicitly asks for the value. It can be passed as the alpha
+ * of _axpy and _scal, where it is read on the device.
+ * @tparam element_t the type of the scalar
+ * @tparam policy_t the policy determining the type of the buffer and events
+ */
+template <typename element_t, typename policy_t>
+class DeviceScalar {
+ public:
+  using value_t = element_t;
+  using container_t = BufferIterator<element_t, policy_t>;
+  using event_t = typename policy_t::event_t;
+
+  DeviceScalar(container_t data, event_t events)
+      : data_(data), events_(events) {}
+
+  /*!
+   * @brief returns the buffer holding the scalar
+   */
+  container_t get_data() const { return data_; }
+
+  /*!
+   * @brief returns the events that must complete before the value is ready
+   */
+  event_t get_events() const { return events_; }
+
+  /*!
+   * @brief blocks until the value is computed and copies it to the host
+   * @param ex the executor the scalar was computed with
+   */
+  template <typename executor_t>
+  element_t get(executor_t &ex) const {
+    element_t res{};
+    auto event = ex.get_policy_handler().copy_to_host(data_, &res, 1);
+    ex.get_policy_handler().wait(event);
+    return res;
+  }
+
+ private:
+  container_t data_;
+  event_t events_;
+};
+
+/*!
+ * @brief Helper function to build a DeviceScalar
+ * @param data the buffer holding the scalar
+ * @param events the events producing the scalar
+ */
+template <typename element_t, typename policy_t>
+inline DeviceScalar<element_t, policy_t> make_device_scalar(
+    BufferIterator<element_t, policy_t> data,
+    typename policy_t::event_t events) {
+  return DeviceScalar<element_t, policy_t>(data, events);
+}
+
+}  // end namespace blas
+#endif  // SYCL_BLAS_DEVICE_SCALAR_H
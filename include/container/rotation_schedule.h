@@ -0,0 +1,176 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename rotation_schedule.h
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_ROTATION_SCHEDULE_H
+#define SYCL_BLAS_ROTATION_SCHEDULE_H
+#include "blas_meta.h"
+#include "container/sycl_iterator.h"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief The plane rotations of a sweep grouped into conflict-free rounds.
+ *
+ * Jacobi and QR sweeps apply many rotations, each to a pair of rows. Two
+ * rotations conflict when they share a row, so the schedule groups the
+ * rotations into rounds in which no row is touched twice; a round can then be
+ * applied by a single kernel. A rotation is always placed in a later round
+ * than the previous rotations sharing one of its rows, so the result is the
+ * same as applying the rotations one after the other.
+ *
+ * The rows of each rotation are kept on the device ordered by round, together
+ * with the position of the rotation in the original sequence, which is used to
+ * look up its cosine and sine. Only the round boundaries are kept on the host.
+ * @tparam index_t the type of the row indices
+ * @tparam policy_t the policy determining the type of the buffers
+ */
+template <typename index_t, typename policy_t>
+class RotationSchedule {
+ public:
+  using container_t = BufferIterator<index_t, policy_t>;
+
+  RotationSchedule(container_t rows_i, container_t rows_j, container_t ids,
+                   std::vector<index_t> round_offsets)
+      : rows_i_(rows_i),
+        rows_j_(rows_j),
+        ids_(ids),
+        round_offsets_(round_offsets) {}
+
+  /*!
+   * @brief returns the first row of each rotation, ordered by round
+   */
+  container_t get_rows_i() const { return rows_i_; }
+
+  /*!
+   * @brief returns the second row of each rotation, ordered by round
+   */
+  container_t get_rows_j() const { return rows_j_; }
+
+  /*!
+   * @brief returns the original position of each rotation, ordered by round
+   */
+  container_t get_ids() const { return ids_; }
+
+  /*!
+   * @brief returns the number of conflict-free rounds
+   */
+  index_t get_num_rounds() const {
+    return static_cast<index_t>(round_offsets_.size()) - 1;
+  }
+
+  /*!
+   * @brief returns the position of the first rotation of a round
+   */
+  index_t get_round_begin(index_t round) const {
+    return round_offsets_[round];
+  }
+
+  /*!
+   * @brief returns the number of rotations in a round
+   */
+  index_t get_round_size(index_t round) const {
+    return round_offsets_[round + 1] - round_offsets_[round];
+  }
+
+ private:
+  container_t rows_i_;
+  container_t rows_j_;
+  container_t ids_;
+  std::vector<index_t> round_offsets_;
+};
+
+/*!
+ * @brief Builds the conflict-free schedule of a sequence of rotations.
+ *
+ * The schedule only depends on the rows, so it is built once per sweep and
+ * reused while the cosines and sines change.
+ * @param ex the executor the schedule is used with
+ * @param num_rotations the number of rotations
+ * @param rows_i host array with the first row of each rotation
+ * @param rows_j host array with the second row of each rotation
+ */
+template <typename executor_t, typename index_t>
+inline RotationSchedule<index_t, typename executor_t::policy_t>
+make_rotation_schedule(executor_t &ex, index_t num_rotations,
+                       const index_t *rows_i, const index_t *rows_j) {
+  // Greedy assignment: each rotation goes to the round after the last round
+  // touching any of its rows
+  std::vector<index_t> round(num_rotations);
+  std::unordered_map<index_t, index_t> last_round;
+  index_t num_rounds = 0;
+  for (index_t r = 0; r < num_rotations; r++) {
+    auto it_i = last_round.find(rows_i[r]);
+    auto it_j = last_round.find(rows_j[r]);
+    index_t prev = -1;
+    if (it_i != last_round.end()) {
+      prev = std::max(prev, it_i->second);
+    }
+    if (it_j != last_round.end()) {
+      prev = std::max(prev, it_j->second);
+    }
+    round[r] = prev + 1;
+    last_round[rows_i[r]] = round[r];
+    last_round[rows_j[r]] = round[r];
+    num_rounds = std::max(num_rounds, round[r] + 1);
+  }
+
+  // Stable counting sort of the rotations by round
+  std::vector<index_t> round_offsets(num_rounds + 1, 0);
+  for (index_t r = 0; r < num_rotations; r++) {
+    round_offsets[round[r] + 1]++;
+  }
+  for (index_t k = 0; k < num_rounds; k++) {
+    round_offsets[k + 1] += round_offsets[k];
+  }
+  std::vector<index_t> next(round_offsets.begin(), round_offsets.end() - 1);
+  std::vector<index_t> sorted_i(num_rotations);
+  std::vector<index_t> sorted_j(num_rotations);
+  std::vector<index_t> ids(num_rotations);
+  for (index_t r = 0; r < num_rotations; r++) {
+    const index_t pos = next[round[r]]++;
+    sorted_i[pos] = rows_i[r];
+    sorted_j[pos] = rows_j[r];
+    ids[pos] = r;
+  }
+
+  const index_t size = std::max(num_rotations, index_t(1));
+  auto gpu_rows_i = make_sycl_iterator_buffer<index_t>(size);
+  auto gpu_rows_j = make_sycl_iterator_buffer<index_t>(size);
+  auto gpu_ids = make_sycl_iterator_buffer<index_t>(size);
+  if (num_rotations > 0) {
+    auto handler = ex.get_policy_handler();
+    handler.wait(
+        handler.copy_to_device(sorted_i.data(), gpu_rows_i, num_rotations),
+        handler.copy_to_device(sorted_j.data(), gpu_rows_j, num_rotations),
+        handler.copy_to_device(ids.data(), gpu_ids, num_rotations));
+  }
+  return RotationSchedule<index_t, typename executor_t::policy_t>(
+      gpu_rows_i, gpu_rows_j, gpu_ids, round_offsets);
+}
+
+}  // end namespace blas
+#endif  // SYCL_BLAS_ROTATION_SCHEDULE_H
@@ -46,6 +46,9 @@ class Executor {
   using policy_t = typename policy_handler_t::policy_t;
   inline Executor(typename policy_t::queue_t q)
       : policy_handler_(policy_handler_t(q)) {}
+  // An executor sharing the state of an existing policy handler
+  inline explicit Executor(policy_handler_t policy_handler)
+      : policy_handler_(policy_handler) {}
   inline policy_handler_t get_policy_handler() const { return policy_handler_; }
 
   template <typename expression_tree_t>
@@ -62,6 +65,10 @@ class Executor {
                                      index_t globalSize,
                                      index_t local_memory_size);
 
+  template <typename tree_t, int chunk_size, bool vectorised>
+  typename policy_t::event_t execute(
+      ChunkedOp<tree_t, chunk_size, vectorised> tree);
+
   template <typename operator_t, typename lhs_t, typename rhs_t>
   typename policy_t::event_t execute(AssignReduction<operator_t, lhs_t, rhs_t>);
 
@@ -25,6 +25,10 @@
 #ifndef SYCL_BLAS_BLAS1_INTERFACE_H
 #define SYCL_BLAS_BLAS1_INTERFACE_H
 #include "blas_meta.h"
+#include "container/device_scalar.h"
+#include "container/rotation_schedule.h"
+#include "operations/blas_constants.h"
+#include "types/accuracy_types.h"
 
 namespace blas {
 namespace internal {
@@ -70,20 +74,27 @@ typename executor_t::policy_t::event_t _copy(executor_t &ex, index_t _N,
  * @param _incx Increment in X axis
  * @param _vx  VectorView
  * @param _incy Increment in Y axis
+ * @tparam accuracy How the products are accumulated
  */
-template <typename executor_t, typename container_0_t, typename container_1_t,
+template <Accuracy accuracy = Accuracy::standard, typename executor_t,
+          typename container_0_t, typename container_1_t,
           typename container_2_t, typename index_t, typename increment_t>
-typename executor_t::policy_t::event_t _dot(
-    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
-    container_1_t _vy, increment_t _incy, container_2_t _rs);
+typename executor_t::policy_t::event_t _dot(executor_t &ex, index_t _N,
+                                            container_0_t _vx,
+                                            increment_t _incx,
+                                            container_1_t _vy,
+                                            increment_t _incy,
+                                            container_2_t _rs);
 /**
  * \brief ASUM Takes the sum of the absolute values
  * @param executor_t<ExecutorType> ex
  * @param _vx  VectorView
  * @param _incx Increment in X axis
+ * @tparam accuracy How the absolute values are accumulated
  */
-template <typename executor_t, typename container_0_t, typename container_1_t,
-          typename index_t, typename increment_t>
+template <Accuracy accuracy = Accuracy::standard, typename executor_t,
+          typename container_0_t, typename container_1_t, typename index_t,
+          typename increment_t>
 typename executor_t::policy_t::event_t _asum(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
@@ -171,6 +182,71 @@ typename executor_t::policy_t::event_t _rot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, element_t _cos, element_t _sin);
 
+/**
+ * @brief _rotm applies the modified Givens transformation H to the pair of
+ * vectors (x, y). H is read on the device from _param, the five elements
+ * (flag, h11, h21, h12, h22) produced by _rotmg, and both vectors are updated
+ * by a single kernel.
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _param Buffer holding the transformation
+ * @param _N data size
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _rotm(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, container_2_t _param);
+
+/**
+ * @brief _rotmg constructs the modified Givens transformation that zeroes the
+ * second component of (sqrt(d1) * x1, sqrt(d2) * y1). All the arguments are
+ * one-element device buffers except _param, which receives the five elements
+ * of the transformation, so the result can be fed to _rotm without a round
+ * trip to the host.
+ * @param executor_t<ExecutorType> ex
+ * @param _d1 Scaling factor of x1, updated in place
+ * @param _d2 Scaling factor of y1, updated in place
+ * @param _x1 First component, updated in place
+ * @param _y1 Second component
+ * @param _param Buffer receiving the transformation
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t>
+typename executor_t::policy_t::event_t _rotmg(executor_t &ex,
+                                              container_0_t _d1,
+                                              container_1_t _d2,
+                                              container_2_t _x1,
+                                              container_3_t _y1,
+                                              container_4_t _param);
+
+/**
+ * @brief _rot_batched applies a sequence of plane rotations to pairs of rows
+ * of x. Rotation r replaces rows (i, j) by (c_r * x_i + s_r * x_j,
+ * c_r * x_j - s_r * x_i). The rotations are applied round by round as given by
+ * _schedule, one kernel per conflict-free round.
+ * @param executor_t<ExecutorType> ex
+ * @param _M Number of rows
+ * @param _N Size of each row
+ * @param _vx  VectorView
+ * @param _incx Increment between two elements of a row
+ * @param _stridex Distance between the first elements of two rows
+ * @param _schedule Rows of each rotation, grouped into rounds
+ * @param _cos Cosine of each rotation, in the original order
+ * @param _sin Sine of each rotation, in the original order
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _rot_batched(
+    executor_t &ex, index_t _M, index_t _N, container_0_t _vx,
+    increment_t _incx, index_t _stridex,
+    const RotationSchedule<index_t, typename executor_t::policy_t> &_schedule,
+    container_1_t _cos, container_1_t _sin);
+
 /**
  * \brief Compute the inner product of two vectors with extended
     precision accumulation and result.
@@ -180,9 +256,11 @@ typename executor_t::policy_t::event_t _rot(
  * @param _incx Increment in X axis
  * @param _vx  VectorView
  * @param _incy Increment in Y axis
+ * @tparam accuracy How the products are accumulated
  */
-template <typename executor_t, typename container_0_t, typename container_1_t,
-          typename index_t, typename increment_t>
+template <Accuracy accuracy = Accuracy::standard, typename executor_t,
+          typename container_0_t, typename container_1_t, typename index_t,
+          typename increment_t>
 typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
@@ -212,11 +290,13 @@ index_t _iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
  * @param executor_t<ExecutorType> ex
  * @param _vx  VectorView
  * @param _incx Increment in X axis
+ * @tparam accuracy How the absolute values are accumulated
  */
-template <typename executor_t, typename container_t, typename index_t,
-          typename increment_t>
+template <Accuracy accuracy = Accuracy::standard, typename executor_t,
+          typename container_t, typename index_t, typename increment_t>
 typename ValueType<container_t>::type _asum(executor_t &ex, index_t _N,
-                                            container_t _vx, increment_t _incx);
+                                            container_t _vx,
+                                            increment_t _incx);
 
 /**
  * \brief NRM2 Returns the euclidian norm of a vector
@@ -229,13 +309,241 @@ template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
                                             container_t _vx, increment_t _incx);
+
+/**
+ * \brief Asynchronous DOT. The result stays on the device and the call does
+ * not block the host.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vx  VectorView
+ * @param _incy Increment in Y axis
+ * @return DeviceScalar holding the result and the events producing it
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+DeviceScalar<typename ValueType<container_0_t>::type,
+             typename executor_t::policy_t>
+_dot_async(executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+           container_1_t _vy, increment_t _incy);
+
+/**
+ * \brief Asynchronous IAMAX. The result stays on the device.
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<IndexValueTuple<typename ValueType<container_t>::type, index_t>,
+             typename executor_t::policy_t>
+_iamax_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
+
+/**
+ * \brief Asynchronous IAMIN. The result stays on the device.
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<IndexValueTuple<typename ValueType<container_t>::type, index_t>,
+             typename executor_t::policy_t>
+_iamin_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
+
+/**
+ * \brief Asynchronous ASUM. The result stays on the device.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<typename ValueType<container_t>::type,
+             typename executor_t::policy_t>
+_asum_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
+
+/**
+ * \brief Asynchronous NRM2. The result stays on the device.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<typename ValueType<container_t>::type,
+             typename executor_t::policy_t>
+_nrm2_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
+
+/**
+ * \brief Strided batched AXPY, y_b = alpha * x_b + y_b for every vector b of
+ * the batch, in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _stridey Distance between the first elements of two y vectors
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy_batched(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, index_t _stridex, container_1_t _vy, increment_t _incy,
+    index_t _stridey, index_t _batch_size);
+
+/**
+ * \brief Strided batched SCAL, x_b = alpha * x_b for every vector b of the
+ * batch, in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename element_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _scal_batched(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, index_t _stridex, index_t _batch_size);
+
+/**
+ * \brief Strided batched DOT. Each vector pair is reduced by its own work
+ * group and its result written to _rs[b], in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _stridey Distance between the first elements of two y vectors
+ * @param _rs Output, one element per vector of the batch
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _vy, increment_t _incy, index_t _stridey,
+    container_2_t _rs, index_t _batch_size);
+
+/**
+ * \brief Strided batched NRM2. Each vector is reduced by its own work group
+ * and its norm written to _rs[b], in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _rs Output, one element per vector of the batch
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _nrm2_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _rs, index_t _batch_size);
+
+/**
+ * \brief AXPBY, y = alpha * x + beta * y, reading and writing each vector
+ * once.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _beta Scaling factor of y
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpby(executor_t &ex, index_t _N,
+                                              element_t _alpha,
+                                              container_0_t _vx,
+                                              increment_t _incx,
+                                              element_t _beta,
+                                              container_1_t _vy,
+                                              increment_t _incy);
+
+/**
+ * \brief WAXPBY, w = alpha * x + beta * y, in a single pass.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _beta Scaling factor of y
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _vw  VectorView
+ * @param _incw Increment in W axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _waxpby(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, element_t _beta, container_1_t _vy, increment_t _incy,
+    container_2_t _vw, increment_t _incw);
+
+/**
+ * \brief Fused AXPY and DOT, y = alpha * x + y and _rs = y . y, updating y
+ * while its squares are summed so y is only read and written once.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _rs Output, the squared norm of the updated y
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _axpy_dot(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    container_2_t _rs);
+
+/**
+ * \brief Fused SCAL and COPY, y = alpha * x, without modifying x.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _scal_copy(executor_t &ex, index_t _N,
+                                                  element_t _alpha,
+                                                  container_0_t _vx,
+                                                  increment_t _incx,
+                                                  container_1_t _vy,
+                                                  increment_t _incy);
 }  // namespace internal
 
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename element_t, typename index_t, typename increment_t>
 typename executor_t::policy_t::event_t _axpy(
     executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
-    increment_t _incx, container_1_t _vy, increment_t _incy) {
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_axpy(ex, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
@@ -252,11 +560,11 @@ typename executor_t::policy_t::event_t _axpy(
  */
 template <typename executor_t, typename index_t, typename container_0_t,
           typename container_1_t, typename increment_t>
-typename executor_t::policy_t::event_t _copy(executor_t &ex, index_t _N,
-                                             container_0_t _vx,
-                                             increment_t _incx,
-                                             container_1_t _vy,
-                                             increment_t _incy) {
+typename executor_t::policy_t::event_t _copy(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_copy(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
 }
@@ -264,36 +572,102 @@ typename executor_t::policy_t::event_t _copy(executor_t &ex, index_t _N,
 /**
  * \brief Compute the inner product of two vectors with extended precision
     accumulation.
+ * @tparam accuracy How the products are accumulated, only the kernels of this
+ * mode are instantiated
  * @param executor_t<ExecutorType> ex
  * @param _vx  VectorView
  * @param _incx Increment in X axis
  * @param _vx  VectorView
  * @param _incy Increment in Y axis
  */
+template <Accuracy accuracy, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename index_t,
+          typename increment_t,
+          class = typename std::enable_if<!std::is_same<
+              container_2_t,
+              typename executor_t::policy_t::event_t>::value>::type>
+typename executor_t::policy_t::event_t _dot(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, container_2_t _rs,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_dot<accuracy>(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+      ex.get_policy_handler().get_buffer(_vy), _incy,
+      ex.get_policy_handler().get_buffer(_rs));
+}
+
+/**
+ * \brief As above, with the accuracy mode chosen at run time.
+ * @param _accuracy How the products are accumulated
+ */
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename index_t, typename increment_t>
 typename executor_t::policy_t::event_t _dot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
-    container_1_t _vy, increment_t _incy, container_2_t _rs) {
-  return internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
-                        ex.get_policy_handler().get_buffer(_vy), _incy,
-                        ex.get_policy_handler().get_buffer(_rs));
+    container_1_t _vy, increment_t _incy, container_2_t _rs,
+    Accuracy _accuracy = Accuracy::standard,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  switch (_accuracy) {
+    case Accuracy::compensated:
+      return _dot<Accuracy::compensated>(ex, _N, _vx, _incx, _vy, _incy, _rs,
+                                         _dependencies);
+    case Accuracy::pairwise:
+      return _dot<Accuracy::pairwise>(ex, _N, _vx, _incx, _vy, _incy, _rs,
+                                      _dependencies);
+    case Accuracy::wide:
+      return _dot<Accuracy::wide>(ex, _N, _vx, _incx, _vy, _incy, _rs,
+                                  _dependencies);
+    default:
+      return _dot<Accuracy::standard>(ex, _N, _vx, _incx, _vy, _incy, _rs,
+                                      _dependencies);
+  }
 }
 
 /**
  * \brief ASUM Takes the sum of the absolute values
+ * @tparam accuracy How the absolute values are accumulated, only the kernels
+ * of this mode are instantiated
  * @param executor_t<ExecutorType> ex
  * @param _vx  VectorView
  * @param _incx Increment in X axis
  */
+template <Accuracy accuracy, typename executor_t, typename container_0_t,
+          typename container_1_t, typename index_t, typename increment_t,
+          class = typename std::enable_if<!std::is_same<
+              container_1_t,
+              typename executor_t::policy_t::event_t>::value>::type>
+typename executor_t::policy_t::event_t _asum(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _rs,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_asum<accuracy>(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+      ex.get_policy_handler().get_buffer(_rs));
+}
+
+/**
+ * \brief As above, with the accuracy mode chosen at run time.
+ * @param _accuracy How the absolute values are accumulated
+ */
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename index_t, typename increment_t>
-typename executor_t::policy_t::event_t _asum(executor_t &ex, index_t _N,
-                                             container_0_t _vx,
-                                             increment_t _incx,
-                                             container_1_t _rs) {
-  return internal::_asum(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
-                         ex.get_policy_handler().get_buffer(_rs));
+typename executor_t::policy_t::event_t _asum(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _rs, Accuracy _accuracy = Accuracy::standard,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  switch (_accuracy) {
+    case Accuracy::compensated:
+      return _asum<Accuracy::compensated>(ex, _N, _vx, _incx, _rs,
+                                          _dependencies);
+    case Accuracy::pairwise:
+      return _asum<Accuracy::pairwise>(ex, _N, _vx, _incx, _rs, _dependencies);
+    case Accuracy::wide:
+      return _asum<Accuracy::wide>(ex, _N, _vx, _incx, _rs, _dependencies);
+    default:
+      return _asum<Accuracy::standard>(ex, _N, _vx, _incx, _rs, _dependencies);
+  }
 }
 
 /**
@@ -303,10 +677,11 @@ typename executor_t::policy_t::event_t _asum(executor_t &ex, index_t _N,
  */
 template <typename executor_t, typename container_t, typename ContainerI,
           typename index_t, typename increment_t>
-typename executor_t::policy_t::event_t _iamax(executor_t &ex, index_t _N,
-                                              container_t _vx,
-                                              increment_t _incx,
-                                              ContainerI _rs) {
+typename executor_t::policy_t::event_t _iamax(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    ContainerI _rs,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_iamax(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                           _incx, ex.get_policy_handler().get_buffer(_rs));
 }
@@ -318,10 +693,11 @@ typename executor_t::policy_t::event_t _iamax(executor_t &ex, index_t _N,
  */
 template <typename executor_t, typename container_t, typename ContainerI,
           typename index_t, typename increment_t>
-typename executor_t::policy_t::event_t _iamin(executor_t &ex, index_t _N,
-                                              container_t _vx,
-                                              increment_t _incx,
-                                              ContainerI _rs) {
+typename executor_t::policy_t::event_t _iamin(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    ContainerI _rs,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_iamin(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                           _incx, ex.get_policy_handler().get_buffer(_rs));
 }
@@ -337,11 +713,11 @@ typename executor_t::policy_t::event_t _iamin(executor_t &ex, index_t _N,
  */
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename index_t, typename increment_t>
-typename executor_t::policy_t::event_t _swap(executor_t &ex, index_t _N,
-                                             container_0_t _vx,
-                                             increment_t _incx,
-                                             container_1_t _vy,
-                                             increment_t _incy) {
+typename executor_t::policy_t::event_t _swap(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_swap(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
 }
@@ -354,10 +730,11 @@ typename executor_t::policy_t::event_t _swap(executor_t &ex, index_t _N,
  */
 template <typename executor_t, typename element_t, typename container_0_t,
           typename index_t, typename increment_t>
-typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
-                                             element_t _alpha,
-                                             container_0_t _vx,
-                                             increment_t _incx) {
+typename executor_t::policy_t::event_t _scal(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_scal(ex, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_vx), _incx);
 }
@@ -370,10 +747,11 @@ typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
  */
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename index_t, typename increment_t>
-typename executor_t::policy_t::event_t _nrm2(executor_t &ex, index_t _N,
-                                             container_0_t _vx,
-                                             increment_t _incx,
-                                             container_1_t _rs) {
+typename executor_t::policy_t::event_t _nrm2(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _rs,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_rs));
 }
@@ -396,31 +774,138 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
           typename element_t, typename index_t, typename increment_t>
 typename executor_t::policy_t::event_t _rot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
-    container_1_t _vy, increment_t _incy, element_t _cos, element_t _sin) {
+    container_1_t _vy, increment_t _incy, element_t _cos, element_t _sin,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_rot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_vy), _incy, _cos,
                         _sin);
 }
 
+/**
+ * @brief _rotm applies the modified Givens transformation H to the pair of
+ * vectors (x, y), reading H on the device from _param.
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _param Buffer holding the transformation
+ * @param _N data size
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _rotm(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, container_2_t _param,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_rotm(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                         _incx, ex.get_policy_handler().get_buffer(_vy), _incy,
+                         ex.get_policy_handler().get_buffer(_param));
+}
+
+/**
+ * @brief _rotmg constructs the modified Givens transformation on the device.
+ * @param executor_t<ExecutorType> ex
+ * @param _d1 Scaling factor of x1, updated in place
+ * @param _d2 Scaling factor of y1, updated in place
+ * @param _x1 First component, updated in place
+ * @param _y1 Second component
+ * @param _param Buffer receiving the transformation
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t>
+typename executor_t::policy_t::event_t _rotmg(
+    executor_t &ex, container_0_t _d1, container_1_t _d2, container_2_t _x1,
+    container_3_t _y1, container_4_t _param,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_rotmg(ex, ex.get_policy_handler().get_buffer(_d1),
+                          ex.get_policy_handler().get_buffer(_d2),
+                          ex.get_policy_handler().get_buffer(_x1),
+                          ex.get_policy_handler().get_buffer(_y1),
+                          ex.get_policy_handler().get_buffer(_param));
+}
+
+/**
+ * @brief _rot_batched applies a sequence of plane rotations to pairs of rows
+ * of x, one kernel per conflict-free round of _schedule.
+ * @param executor_t<ExecutorType> ex
+ * @param _M Number of rows
+ * @param _N Size of each row
+ * @param _vx  VectorView
+ * @param _incx Increment between two elements of a row
+ * @param _stridex Distance between the first elements of two rows
+ * @param _schedule Rows of each rotation, grouped into rounds
+ * @param _cos Cosine of each rotation, in the original order
+ * @param _sin Sine of each rotation, in the original order
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _rot_batched(
+    executor_t &ex, index_t _M, index_t _N, container_0_t _vx,
+    increment_t _incx, index_t _stridex,
+    const RotationSchedule<index_t, typename executor_t::policy_t> &_schedule,
+    container_1_t _cos, container_1_t _sin,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_rot_batched(
+      ex, _M, _N, ex.get_policy_handler().get_buffer(_vx), _incx, _stridex,
+      _schedule, ex.get_policy_handler().get_buffer(_cos),
+      ex.get_policy_handler().get_buffer(_sin));
+}
+
 /**
  * \brief Compute the inner product of two vectors with extended
     precision accumulation and result.
  *
+ * @tparam accuracy How the products are accumulated, only the kernels of this
+ * mode are instantiated
  * @param executor_t<ExecutorType> ex
  * @param _vx  VectorView
  * @param _incx Increment in X axis
  * @param _vx  VectorView
  * @param _incy Increment in Y axis
  */
+template <Accuracy accuracy, typename executor_t, typename container_0_t,
+          typename container_1_t, typename index_t, typename increment_t>
+typename ValueType<container_0_t>::type _dot(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_dot<accuracy>(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+      ex.get_policy_handler().get_buffer(_vy), _incy);
+}
+
+/**
+ * \brief As above, with the accuracy mode chosen at run time.
+ * @param _accuracy How the products are accumulated
+ */
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename index_t, typename increment_t>
-typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
-                                             container_0_t _vx,
-                                             increment_t _incx,
-                                             container_1_t _vy,
-                                             increment_t _incy) {
-  return internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
-                        ex.get_policy_handler().get_buffer(_vy), _incy);
+typename ValueType<container_0_t>::type _dot(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    Accuracy _accuracy = Accuracy::standard,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  switch (_accuracy) {
+    case Accuracy::compensated:
+      return _dot<Accuracy::compensated>(ex, _N, _vx, _incx, _vy, _incy,
+                                         _dependencies);
+    case Accuracy::pairwise:
+      return _dot<Accuracy::pairwise>(ex, _N, _vx, _incx, _vy, _incy,
+                                      _dependencies);
+    case Accuracy::wide:
+      return _dot<Accuracy::wide>(ex, _N, _vx, _incx, _vy, _incy,
+                                  _dependencies);
+    default:
+      return _dot<Accuracy::standard>(ex, _N, _vx, _incx, _vy, _incy,
+                                      _dependencies);
+  }
 }
 
 /**
@@ -430,7 +915,10 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
  */
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
-index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+index_t _iamax(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_iamax(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                           _incx);
 }
@@ -442,7 +930,10 @@ index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
  */
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
-index_t _iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+index_t _iamin(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_iamin(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                           _incx);
 }
@@ -450,17 +941,42 @@ index_t _iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
 /**
  * \brief ASUM Takes the sum of the absolute values
  *
+ * @tparam accuracy How the absolute values are accumulated, only the kernels
+ * of this mode are instantiated
  * @param executor_t<ExecutorType> ex
  * @param _vx  VectorView
  * @param _incx Increment in X axis
  */
+template <Accuracy accuracy, typename executor_t, typename container_t,
+          typename index_t, typename increment_t>
+typename ValueType<container_t>::type _asum(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_asum<accuracy>(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
+/**
+ * \brief As above, with the accuracy mode chosen at run time.
+ * @param _accuracy How the absolute values are accumulated
+ */
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
-typename ValueType<container_t>::type _asum(executor_t &ex, index_t _N,
-                                            container_t _vx,
-                                            increment_t _incx) {
-  return internal::_asum(ex, _N, ex.get_policy_handler().get_buffer(_vx),
-                         _incx);
+typename ValueType<container_t>::type _asum(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    Accuracy _accuracy = Accuracy::standard,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  switch (_accuracy) {
+    case Accuracy::compensated:
+      return _asum<Accuracy::compensated>(ex, _N, _vx, _incx, _dependencies);
+    case Accuracy::pairwise:
+      return _asum<Accuracy::pairwise>(ex, _N, _vx, _incx, _dependencies);
+    case Accuracy::wide:
+      return _asum<Accuracy::wide>(ex, _N, _vx, _incx, _dependencies);
+    default:
+      return _asum<Accuracy::standard>(ex, _N, _vx, _incx, _dependencies);
+  }
 }
 
 /**
@@ -472,12 +988,321 @@ typename ValueType<container_t>::type _asum(executor_t &ex, index_t _N,
  */
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
-typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
-                                            container_t _vx,
-                                            increment_t _incx) {
+typename ValueType<container_t>::type _nrm2(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                          _incx);
 }
 
+/**
+ * \brief Asynchronous DOT. The result stays on the device and the call does
+ * not block the host.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vx  VectorView
+ * @param _incy Increment in Y axis
+ * @return DeviceScalar holding the result and the events producing it
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+DeviceScalar<typename ValueType<container_0_t>::type,
+             typename executor_t::policy_t>
+_dot_async(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_dot_async(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                              _incx, ex.get_policy_handler().get_buffer(_vy),
+                              _incy);
+}
+
+/**
+ * \brief Asynchronous IAMAX. The result stays on the device.
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<IndexValueTuple<typename ValueType<container_t>::type, index_t>,
+             typename executor_t::policy_t>
+_iamax_async(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_iamax_async(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                                _incx);
+}
+
+/**
+ * \brief Asynchronous IAMIN. The result stays on the device.
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<IndexValueTuple<typename ValueType<container_t>::type, index_t>,
+             typename executor_t::policy_t>
+_iamin_async(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_iamin_async(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                                _incx);
+}
+
+/**
+ * \brief Asynchronous ASUM. The result stays on the device.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<typename ValueType<container_t>::type,
+             typename executor_t::policy_t>
+_asum_async(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_asum_async(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                               _incx);
+}
+
+/**
+ * \brief Asynchronous NRM2. The result stays on the device.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<typename ValueType<container_t>::type,
+             typename executor_t::policy_t>
+_nrm2_async(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_nrm2_async(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                               _incx);
+}
+
+/**
+ * \brief Strided batched AXPY, y_b = alpha * x_b + y_b for every vector b of
+ * the batch, in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _stridey Distance between the first elements of two y vectors
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy_batched(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, index_t _stridex, container_1_t _vy, increment_t _incy,
+    index_t _stridey, index_t _batch_size,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_axpy_batched(ex, _N, _alpha,
+                                 ex.get_policy_handler().get_buffer(_vx), _incx,
+                                 _stridex,
+                                 ex.get_policy_handler().get_buffer(_vy), _incy,
+                                 _stridey, _batch_size);
+}
+
+/**
+ * \brief Strided batched SCAL, x_b = alpha * x_b for every vector b of the
+ * batch, in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename element_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _scal_batched(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, index_t _stridex, index_t _batch_size,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_scal_batched(ex, _N, _alpha,
+                                 ex.get_policy_handler().get_buffer(_vx), _incx,
+                                 _stridex, _batch_size);
+}
+
+/**
+ * \brief Strided batched DOT. Each vector pair is reduced by its own work
+ * group and its result written to _rs[b], in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _stridey Distance between the first elements of two y vectors
+ * @param _rs Output, one element per vector of the batch
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _vy, increment_t _incy, index_t _stridey,
+    container_2_t _rs, index_t _batch_size,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_dot_batched(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                                _incx, _stridex,
+                                ex.get_policy_handler().get_buffer(_vy), _incy,
+                                _stridey,
+                                ex.get_policy_handler().get_buffer(_rs),
+                                _batch_size);
+}
+
+/**
+ * \brief Strided batched NRM2. Each vector is reduced by its own work group
+ * and its norm written to _rs[b], in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _rs Output, one element per vector of the batch
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _nrm2_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _rs, index_t _batch_size,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_nrm2_batched(ex, _N,
+                                 ex.get_policy_handler().get_buffer(_vx), _incx,
+                                 _stridex,
+                                 ex.get_policy_handler().get_buffer(_rs),
+                                 _batch_size);
+}
+
+/**
+ * \brief AXPBY, y = alpha * x + beta * y, reading and writing each vector
+ * once.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _beta Scaling factor of y
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpby(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, element_t _beta, container_1_t _vy, increment_t _incy,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_axpby(ex, _N, _alpha,
+                          ex.get_policy_handler().get_buffer(_vx), _incx,
+                          _beta, ex.get_policy_handler().get_buffer(_vy),
+                          _incy);
+}
+
+/**
+ * \brief WAXPBY, w = alpha * x + beta * y, in a single pass.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _beta Scaling factor of y
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _vw  VectorView
+ * @param _incw Increment in W axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _waxpby(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, element_t _beta, container_1_t _vy, increment_t _incy,
+    container_2_t _vw, increment_t _incw,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_waxpby(ex, _N, _alpha,
+                           ex.get_policy_handler().get_buffer(_vx), _incx,
+                           _beta, ex.get_policy_handler().get_buffer(_vy),
+                           _incy, ex.get_policy_handler().get_buffer(_vw),
+                           _incw);
+}
+
+/**
+ * \brief Fused AXPY and DOT, y = alpha * x + y and _rs = y . y, updating y
+ * while its squares are summed so y is only read and written once.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _rs Output, the squared norm of the updated y
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _axpy_dot(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy, container_2_t _rs,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_axpy_dot(ex, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             ex.get_policy_handler().get_buffer(_vy), _incy,
+                             ex.get_policy_handler().get_buffer(_rs));
+}
+
+/**
+ * \brief Fused SCAL and COPY, y = alpha * x, without modifying x.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _scal_copy(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    const typename executor_t::policy_t::event_t &_dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_scal_copy(ex, _N, _alpha,
+                              ex.get_policy_handler().get_buffer(_vx), _incx,
+                              ex.get_policy_handler().get_buffer(_vy), _incy);
+}
+
 }  // end namespace blas
 #endif  // SYCL_BLAS_BLAS1_INTERFACE
@@ -63,6 +63,61 @@ typename executor_t::policy_t::event_t _gemv(
     increment_t _incy  // The increment for elements in y (nonzero).
 );
 
+/*!
+ @brief Strided batch of generalised matrix vector products with rectangular
+ non-symmetric matrices.
+
+ Computes y_b = alpha*A_b*x_b + beta*y_b for b = 0 .. batch_size-1, where A_b,
+ x_b and y_b start at b*strideA, b*stridex and b*stridey respectively. The
+ whole batch is computed by a single kernel.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_batched(
+    executor_t& ex,       // executor_t (sycl, parallel, serial, etc)
+    char _trans,          // The transposition of the matrices ('n', 't', 'c')
+    index_t _M,           // The number of rows of each matrix
+    index_t _N,           // The number of columns of each matrix
+    element_t _alpha,     // Scalar parameter Alpha
+    container_0_t _mA,    // The batch of matrices
+    index_t _lda,         // The leading dimension of each matrix
+    index_t _strideA,     // The distance between two consecutive matrices
+    container_1_t _vx,    // The batch of vectors "x"
+    increment_t _incx,    // The increment for elements in x (nonzero)
+    index_t _stridex,     // The distance between two consecutive x
+    element_t _beta,      // Scalar parameter Beta
+    container_2_t _vy,    // The batch of vectors "y", overwritten
+    increment_t _incy,    // The increment for elements in y (nonzero)
+    index_t _stridey,     // The distance between two consecutive y
+    index_t _batch_size   // The number of products
+);
+
+/*!
+ @brief Generalised matrix vector product of one matrix with several vectors.
+
+ Computes Y = alpha*A*X + beta*Y, where the K vectors are the columns of X and
+ Y. Unlike K calls to _gemv, A is read once for every 16 vectors.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_multi_vector(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _trans,        // The transposition of the matrix ('n', 't', 'c')
+    index_t _M,         // The size of dimension M of the matrix (rows)
+    index_t _N,         // The size of dimension N of the matrix (columns)
+    index_t _K,         // The number of vectors
+    element_t _alpha,   // Scalar parameter Alpha
+    container_0_t _mA,  // An array (LDA,N), with the first m*n elements
+    index_t _lda,       // Specifies the first dimension of a, max(1, m)
+    container_1_t _mX,  // An array (LDX,K) holding the vectors "x"
+    index_t _ldx,       // The first dimension of X
+    element_t _beta,    // Scalar parameter Beta
+    container_2_t _mY,  // An array (LDY,K) holding the vectors "y", overwritten
+    index_t _ldy        // The first dimension of Y
+);
+
 /*!
  @brief Generalised matrix vector product with a triangular symmetric matrix.
 
@@ -89,6 +144,31 @@ typename executor_t::policy_t::event_t _trmv(
     increment_t _incx   // !=0 The increment for the elements of X
 );
 
+/*!
+ @brief Solution of a triangular system of equations.
+
+ Solution of a triangular system of equations, i.e. computing:
+
+ x = A**-1*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/strsv.f
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _trsv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    container_0_t _mA,  // (_lda, _N) The input matrix
+    index_t _lda,       // >max(1, _N) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input and output X
+    increment_t _incx   // !=0 The increment for the elements of X
+);
+
 /*!
  @brief Generalised matrix vector product with a rectangular symmetric
  matrix, followed by a vector sum.
@@ -205,6 +285,177 @@ typename executor_t::policy_t::event_t _syr2(
     container_2_t _mA,  // (_lda, _N) The output matrix
     index_t _lda        // >max(1, _N) The first dimension of _mA
 );
+/*!
+ @brief Generalised matrix vector product with a banded matrix.
+
+ Generalised matrix vector product with a banded matrix of KL sub-diagonals
+ and KU super-diagonals, i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ Only the band, stored as a (KL + KU + 1) x N matrix, is read.
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/sgbmv.f
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _trans,        // The transposition of the matrix ('n', 't', 'c')
+    index_t _M,         // The rows of matrix A
+    index_t _N,         // The cols of matrix A
+    index_t _KL,        // The number of sub-diagonals of A
+    index_t _KU,        // The number of super-diagonals of A
+    element_t _alpha,   // Scalar parameter alpha
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_KL + _KU + 1) The first dimension of _mA
+    container_1_t _vx,  // The input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter beta
+    container_2_t _vy,  // The output vector Y
+    increment_t _incy   // !=0 The increment for the elements of Y
+);
+
+/*!
+ @brief Matrix vector product with a symmetric banded matrix.
+
+ Matrix vector product with a symmetric banded matrix of K sub-diagonals and
+ K super-diagonals, i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ Only one triangle of the band, stored as a (K + 1) x N matrix, is read.
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/ssbmv.f
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _sbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // The stored band, upper/lower ('u', 'l')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // The number of super-diagonals of A
+    element_t _alpha,   // Scalar parameter alpha
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter beta
+    container_2_t _vy,  // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy   // !=0 The increment for the elements of Y
+);
+
+/*!
+ @brief Matrix vector product with a triangular banded matrix.
+
+ Matrix vector product with a triangular banded matrix of K diagonals besides
+ the main one, i.e. computing the mathematical operation:
+
+ x = A*x
+
+ Only the band, stored as a (K + 1) x N matrix, is read.
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/stbmv.f
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _tbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // The number of off-diagonals of A
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), output vector X
+    increment_t _incx   // !=0 The increment for the elements of X
+);
+
+/*!
+ @brief Matrix vector product with a packed symmetric matrix.
+
+ Matrix vector product with a symmetric matrix of which one triangle is packed
+ column by column, i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/sspmv.f
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _spmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // The packed triangle, upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar parameter alpha
+    container_0_t _mAP,  // (_N * (_N + 1) / 2) The packed matrix
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    element_t _beta,     // Scalar parameter beta
+    container_2_t _vy,   // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy    // !=0 The increment for the elements of Y
+);
+
+/*!
+ @brief Matrix vector product with a packed triangular matrix.
+
+ Matrix vector product with a triangular matrix packed column by column, i.e.
+ computing the mathematical operation:
+
+ x = A*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/stpmv.f
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _tpmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,         // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,          // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,          // >0 The order of matrix A
+    container_0_t _mAP,  // (_N * (_N + 1) / 2) The packed matrix
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), output vector X
+    increment_t _incx    // !=0 The increment for the elements of X
+);
+
+/*!
+ @brief Rank 1 update of a packed symmetric matrix.
+
+ Rank 1 update of a symmetric matrix of which one triangle is packed column by
+ column, i.e. computing the mathematical operation:
+
+ A = alpha*x*x**T + A
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/sspr.f
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t>
+typename executor_t::policy_t::event_t _spr(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // The packed triangle, upper/lower ('u', 'l')
+    index_t _N,         // >0 The order of matrix A
+    element_t _alpha,   // Scalar parameter alpha
+    container_0_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    container_1_t _mAP  // (_N * (_N + 1) / 2) The packed matrix, output
+);
 }  // namespace internal
 
 /*!
@@ -240,14 +491,86 @@ typename executor_t::policy_t::event_t inline _gemv(
                         // when trans = "n" and (1+(n-1)*abs(incy) otherwise,
     // containing the vector "y" (if beta is nonzero). When
     // finished, y is overwritten with the updated vector.
-    increment_t _incy  // The increment for elements in y (nonzero).
-) {
+    increment_t _incy,  // The increment for elements in y (nonzero).
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_gemv(ex, _trans, _M, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_mA), _lda,
                          ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
 }
 
+/*!
+ @brief Strided batch of generalised matrix vector products with rectangular
+ non-symmetric matrices.
+
+ Computes y_b = alpha*A_b*x_b + beta*y_b for b = 0 .. batch_size-1, where A_b,
+ x_b and y_b start at b*strideA, b*stridex and b*stridey respectively. The
+ whole batch is computed by a single kernel.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gemv_batched(
+    executor_t& ex,       // executor_t (sycl, parallel, serial, etc)
+    char _trans,          // The transposition of the matrices ('n', 't', 'c')
+    index_t _M,           // The number of rows of each matrix
+    index_t _N,           // The number of columns of each matrix
+    element_t _alpha,     // Scalar parameter Alpha
+    container_0_t _mA,    // The batch of matrices
+    index_t _lda,         // The leading dimension of each matrix
+    index_t _strideA,     // The distance between two consecutive matrices
+    container_1_t _vx,    // The batch of vectors "x"
+    increment_t _incx,    // The increment for elements in x (nonzero)
+    index_t _stridex,     // The distance between two consecutive x
+    element_t _beta,      // Scalar parameter Beta
+    container_2_t _vy,    // The batch of vectors "y", overwritten
+    increment_t _incy,    // The increment for elements in y (nonzero)
+    index_t _stridey,     // The distance between two consecutive y
+    index_t _batch_size,  // The number of products
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_gemv_batched(
+      ex, _trans, _M, _N, _alpha, ex.get_policy_handler().get_buffer(_mA),
+      _lda, _strideA, ex.get_policy_handler().get_buffer(_vx), _incx, _stridex,
+      _beta, ex.get_policy_handler().get_buffer(_vy), _incy, _stridey,
+      _batch_size);
+}
+
+/*!
+ @brief Generalised matrix vector product of one matrix with several vectors.
+
+ Computes Y = alpha*A*X + beta*Y, where the K vectors are the columns of X and
+ Y. Unlike K calls to _gemv, A is read once for every 16 vectors.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gemv_multi_vector(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _trans,        // The transposition of the matrix ('n', 't', 'c')
+    index_t _M,         // The size of dimension M of the matrix (rows)
+    index_t _N,         // The size of dimension N of the matrix (columns)
+    index_t _K,         // The number of vectors
+    element_t _alpha,   // Scalar parameter Alpha
+    container_0_t _mA,  // An array (LDA,N), with the first m*n elements
+    index_t _lda,       // Specifies the first dimension of a, max(1, m)
+    container_1_t _mX,  // An array (LDX,K) holding the vectors "x"
+    index_t _ldx,       // The first dimension of X
+    element_t _beta,    // Scalar parameter Beta
+    container_2_t _mY,  // An array (LDY,K) holding the vectors "y", overwritten
+    index_t _ldy,       // The first dimension of Y
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_gemv_multi_vector(
+      ex, _trans, _M, _N, _K, _alpha, ex.get_policy_handler().get_buffer(_mA),
+      _lda, ex.get_policy_handler().get_buffer(_mX), _ldx, _beta,
+      ex.get_policy_handler().get_buffer(_mY), _ldy);
+}
+
 /*!
  @brief Generalised matrix vector product with a triangular symmetric matrix.
 
@@ -271,13 +594,46 @@ typename executor_t::policy_t::event_t inline _trmv(
     container_0_t _mA,  // (_lda, _N) The input matrix
     index_t _lda,       // >max(1, _N) The first dimension of _mA
     container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), output vector X
-    increment_t _incx   // !=0 The increment for the elements of X
-) {
+    increment_t _incx,  // !=0 The increment for the elements of X
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_trmv(ex, _Uplo, _trans, _Diag, _N,
                          ex.get_policy_handler().get_buffer(_mA), _lda,
                          ex.get_policy_handler().get_buffer(_vx), _incx);
 }
 
+/*!
+ @brief Solution of a triangular system of equations.
+
+ Solution of a triangular system of equations, i.e. computing:
+
+ x = A**-1*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/strsv.f
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t inline _trsv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    container_0_t _mA,  // (_lda, _N) The input matrix
+    index_t _lda,       // >max(1, _N) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input and output X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_trsv(ex, _Uplo, _trans, _Diag, _N,
+                         ex.get_policy_handler().get_buffer(_mA), _lda,
+                         ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
 /*!
  @brief Generalised matrix vector product with a rectangular symmetric
  matrix, followed by a vector sum.
@@ -306,8 +662,10 @@ typename executor_t::policy_t::event_t inline _symv(
     increment_t _incx,  // !=0 The increment for the elements of X
     element_t _beta,    // Scalar parameter beta
     container_2_t _vy,  // (1 + (_N-1)*abs(_incy)), output vector Y
-    increment_t _incy   // !=0 The increment for the elements of Y
-) {
+    increment_t _incy,  // !=0 The increment for the elements of Y
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_symv(ex, _Uplo, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_mA), _lda,
                          ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
@@ -341,8 +699,10 @@ typename executor_t::policy_t::event_t inline _ger(
     container_1_t _vy,  // >(1 + (_N-1)*abs(_incy)), input vector Y
     increment_t _incy,  // Increment for vector Y
     container_2_t _mA,  // (_lda, n) array containing A, the output
-    index_t _lda        // >max(1, m), Leading dimension of A
-) {
+    index_t _lda,       // >max(1, m), Leading dimension of A
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_ger(ex, _M, _N, _alpha,
                         ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_vy), _incy,
@@ -372,8 +732,10 @@ typename executor_t::policy_t::event_t inline _syr(
     container_0_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
     increment_t _incx,  // !=0 The increment for the elements of X
     container_1_t _mA,  // (_lda, _N) The output matrix
-    index_t _lda        // >max(1, _N) The first dimension of _mA
-) {
+    index_t _lda,       // >max(1, _N) The first dimension of _mA
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_syr(ex, _Uplo, _N, _alpha,
                         ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_mA), _lda);
@@ -406,13 +768,226 @@ typename executor_t::policy_t::event_t inline _syr2(
     container_1_t _vy,  // (1 + (_N-1)*abs(_incx)), input vector Y
     increment_t _incy,  // !=0 The increment for the elements of Y
     container_2_t _mA,  // (_lda, _N) The output matrix
-    index_t _lda        // >max(1, _N) The first dimension of _mA
-) {
+    index_t _lda,       // >max(1, _N) The first dimension of _mA
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_syr2(ex, _Uplo, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy,
                          ex.get_policy_handler().get_buffer(_mA), _lda);
 }
+/*!
+ @brief Generalised matrix vector product with a banded matrix.
+
+ Generalised matrix vector product with a banded matrix of KL sub-diagonals
+ and KU super-diagonals, i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ Only the band, stored as a (KL + KU + 1) x N matrix, is read.
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/sgbmv.f
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _trans,        // The transposition of the matrix ('n', 't', 'c')
+    index_t _M,         // The rows of matrix A
+    index_t _N,         // The cols of matrix A
+    index_t _KL,        // The number of sub-diagonals of A
+    index_t _KU,        // The number of super-diagonals of A
+    element_t _alpha,   // Scalar parameter alpha
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_KL + _KU + 1) The first dimension of _mA
+    container_1_t _vx,  // The input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter beta
+    container_2_t _vy,  // The output vector Y
+    increment_t _incy,  // !=0 The increment for the elements of Y
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_gbmv(ex, _trans, _M, _N, _KL, _KU, _alpha,
+                         ex.get_policy_handler().get_buffer(_mA), _lda,
+                         ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
+                         ex.get_policy_handler().get_buffer(_vy), _incy);
+}
+
+/*!
+ @brief Matrix vector product with a symmetric banded matrix.
+
+ Matrix vector product with a symmetric banded matrix of K sub-diagonals and
+ K super-diagonals, i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ Only one triangle of the band, stored as a (K + 1) x N matrix, is read.
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/ssbmv.f
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _sbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // The stored band, upper/lower ('u', 'l')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // The number of super-diagonals of A
+    element_t _alpha,   // Scalar parameter alpha
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter beta
+    container_2_t _vy,  // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy,  // !=0 The increment for the elements of Y
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_sbmv(ex, _Uplo, _N, _K, _alpha,
+                         ex.get_policy_handler().get_buffer(_mA), _lda,
+                         ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
+                         ex.get_policy_handler().get_buffer(_vy), _incy);
+}
+
+/*!
+ @brief Matrix vector product with a triangular banded matrix.
+
+ Matrix vector product with a triangular banded matrix of K diagonals besides
+ the main one, i.e. computing the mathematical operation:
+
+ x = A*x
+
+ Only the band, stored as a (K + 1) x N matrix, is read.
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/stbmv.f
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t inline _tbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // The number of off-diagonals of A
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), output vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_tbmv(ex, _Uplo, _trans, _Diag, _N, _K,
+                         ex.get_policy_handler().get_buffer(_mA), _lda,
+                         ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
+/*!
+ @brief Matrix vector product with a packed symmetric matrix.
+
+ Matrix vector product with a symmetric matrix of which one triangle is packed
+ column by column, i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/sspmv.f
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _spmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // The packed triangle, upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar parameter alpha
+    container_0_t _mAP,  // (_N * (_N + 1) / 2) The packed matrix
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    element_t _beta,     // Scalar parameter beta
+    container_2_t _vy,   // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy,   // !=0 The increment for the elements of Y
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_spmv(ex, _Uplo, _N, _alpha,
+                         ex.get_policy_handler().get_buffer(_mAP),
+                         ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
+                         ex.get_policy_handler().get_buffer(_vy), _incy);
+}
+
+/*!
+ @brief Matrix vector product with a packed triangular matrix.
+
+ Matrix vector product with a triangular matrix packed column by column, i.e.
+ computing the mathematical operation:
+
+ x = A*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/stpmv.f
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t inline _tpmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,         // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,          // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,          // >0 The order of matrix A
+    container_0_t _mAP,  // (_N * (_N + 1) / 2) The packed matrix
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), output vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_tpmv(ex, _Uplo, _trans, _Diag, _N,
+                         ex.get_policy_handler().get_buffer(_mAP),
+                         ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
+/*!
+ @brief Rank 1 update of a packed symmetric matrix.
+
+ Rank 1 update of a symmetric matrix of which one triangle is packed column by
+ column, i.e. computing the mathematical operation:
+
+ A = alpha*x*x**T + A
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/blas/sspr.f
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t>
+typename executor_t::policy_t::event_t inline _spr(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // The packed triangle, upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar parameter alpha
+    container_0_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    container_1_t _mAP,  // (_N * (_N + 1) / 2) The packed matrix, output
+    // Events to wait for before the computation starts
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  return internal::_spr(ex, _Uplo, _N, _alpha,
+                        ex.get_policy_handler().get_buffer(_vx), _incx,
+                        ex.get_policy_handler().get_buffer(_mAP));
+}
+
 }  // namespace blas
 
 #endif  // SYCL_BLAS_BLAS2_INTERFACE
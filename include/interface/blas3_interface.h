@@ -53,13 +53,13 @@ typename executor_t::policy_t::event_t _gemm_batched(
 }  // namespace internal
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
-typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
-                                             char _TransB, index_t _M,
-                                             index_t _N, index_t _K,
-                                             element_t _alpha, container_0_t a_,
-                                             index_t _lda, container_1_t b_,
-                                             index_t _ldb, element_t _beta,
-                                             container_2_t _C, index_t _ldc) {
+typename executor_t::policy_t::event_t _gemm(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc,
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_gemm(ex, _TransA, _TransB, _M, _N, _K, _alpha,
                          ex.get_policy_handler().get_buffer(a_), _lda,
                          ex.get_policy_handler().get_buffer(b_), _ldb, _beta,
@@ -72,12 +72,268 @@ typename executor_t::policy_t::event_t _gemm_batched(
     executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
     index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
     container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
-    index_t _ldc, index_t batch_size) {
+    index_t _ldc, index_t batch_size,
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  ex.get_policy_handler().add_dependencies(_dependencies);
   return internal::_gemm_batched(ex, _TransA, _TransB, _M, _N, _K, _alpha,
                                  ex.get_policy_handler().get_buffer(a_), _lda,
                                  ex.get_policy_handler().get_buffer(b_), _ldb,
                                  _beta, ex.get_policy_handler().get_buffer(_C),
                                  _ldc, batch_size);
 }
+
+namespace internal {
+/*!
+ * @brief Computes C = beta * C on a host matrix, which is all GEMM does when
+ * there is no product to accumulate. C is set to zero when beta is zero, as in
+ * reference BLAS.
+ */
+template <typename element_t, typename index_t>
+inline void _scal_host_matrix(index_t _M, index_t _N, element_t _beta,
+                              element_t* _C, index_t _ldc) {
+  for (index_t j = 0; j < _N; j++) {
+    for (index_t i = 0; i < _M; i++) {
+      _C[i + j * _ldc] =
+          (_beta == element_t(0)) ? element_t(0) : _beta * _C[i + j * _ldc];
+    }
+  }
+}
+}  // namespace internal
+
+/*!
+ * @brief GEMM on host matrices, with the transfers pipelined with the
+ * computation.
+ *
+ * C is computed by panels of columns. Each panel of C, and of B when it is
+ * not transposed, is uploaded into a device buffer of its own, so that the
+ * GEMM of a panel only depends on its own uploads and can run while the next
+ * panels are transferred. Each panel of C is copied back as soon as it is
+ * computed. A is uploaded whole, as every panel needs it, and so is a
+ * transposed B, whose panels are not contiguous.
+ * On devices sharing the host memory, suitably aligned matrices are used in
+ * place without any copy (see PolicyHandler::is_zero_copy), and C has been
+ * written when the function returns.
+ * @param _panelCols the number of columns of C per panel, 0 to split C in
+ * four panels
+ * @return the events of the copies of C back to the host, the host matrices
+ * must be kept alive until they complete
+ */
+template <typename executor_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_host(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, const element_t* a_, index_t _lda,
+    const element_t* b_, index_t _ldb, element_t _beta, element_t* _C,
+    index_t _ldc, index_t _panelCols = 0,
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  using buffer_t = BufferIterator<element_t, typename executor_t::policy_t>;
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  if (_M == 0 || _N == 0) {
+    return {};
+  }
+  if (_K == 0) {
+    internal::_scal_host_matrix(_M, _N, _beta, _C, _ldc);
+    return {};
+  }
+  auto policy_handler = ex.get_policy_handler();
+  const bool trA = (tolower(_TransA) != 'n');
+  const bool trB = (tolower(_TransB) != 'n');
+  const index_t panelCols = (_panelCols == 0)
+                                ? std::max(index_t(1), (_N + 3) / 4)
+                                : std::min(_N, _panelCols);
+
+  // Extent of each matrix, the last column being only as long as needed
+  const index_t sizeA = _lda * ((trA ? _M : _K) - 1) + (trA ? _K : _M);
+  const index_t sizeB = _ldb * ((trB ? _K : _N) - 1) + (trB ? _N : _K);
+  const index_t sizeC = _ldc * (_N - 1) + _M;
+
+  // Suitably aligned matrices are used in place by devices sharing the host
+  // memory, C being written back when its buffer is destroyed
+  if (policy_handler.is_zero_copy(a_) && policy_handler.is_zero_copy(b_) &&
+      policy_handler.is_zero_copy(_C)) {
+    return internal::_gemm(ex, _TransA, _TransB, _M, _N, _K, _alpha,
+                           policy_handler.get_host_buffer(a_, sizeA), _lda,
+                           policy_handler.get_host_buffer(b_, sizeB), _ldb,
+                           _beta, policy_handler.get_host_buffer(_C, sizeC),
+                           _ldc);
+  }
+
+  auto a_gpu = make_sycl_iterator_buffer<element_t>(sizeA);
+  policy_handler.copy_to_device(a_, a_gpu, sizeA);
+  // The accessors of a GEMM cover its matrices up to the end of their
+  // buffers, so the panels get separate buffers rather than offsets into a
+  // shared one
+  std::vector<buffer_t> b_gpu;
+  std::vector<buffer_t> c_gpu;
+  if (trB) {
+    b_gpu.push_back(make_sycl_iterator_buffer<element_t>(sizeB));
+    policy_handler.copy_to_device(b_, b_gpu.back(), sizeB);
+  }
+
+  typename executor_t::policy_t::event_t ret;
+  for (index_t j = 0; j < _N; j += panelCols) {
+    const index_t cols = std::min(panelCols, _N - j);
+    if (!trB) {
+      const index_t sizeBPanel = _ldb * (cols - 1) + _K;
+      b_gpu.push_back(make_sycl_iterator_buffer<element_t>(sizeBPanel));
+      policy_handler.copy_to_device(b_ + j * _ldb, b_gpu.back(), sizeBPanel);
+    }
+    const index_t sizeCPanel = _ldc * (cols - 1) + _M;
+    c_gpu.push_back(make_sycl_iterator_buffer<element_t>(sizeCPanel));
+    // C is also uploaded when it has padding rows, which are copied back.
+    // Otherwise it is zeroed, so that no kernel reads uninitialised memory.
+    if (_beta != element_t(0) || _ldc != _M) {
+      policy_handler.copy_to_device(_C + j * _ldc, c_gpu.back(), sizeCPanel);
+    } else {
+      policy_handler.fill(c_gpu.back(), element_t(0), sizeCPanel);
+    }
+    internal::_gemm(ex, _TransA, _TransB, _M, cols, _K, _alpha, a_gpu, _lda,
+                    trB ? b_gpu.front() + j : b_gpu.back(), _ldb, _beta,
+                    c_gpu.back(), _ldc);
+    auto event =
+        policy_handler.copy_to_host(c_gpu.back(), _C + j * _ldc, sizeCPanel);
+    ret.insert(ret.end(), event.begin(), event.end());
+  }
+  return ret;
+}
+
+/*!
+ * @brief GEMM on host matrices that may not fit in device memory.
+ *
+ * C is computed by tiles and each tile accumulates the products of the panels
+ * of A and B along K, beta only being applied by the first panel. The panels
+ * are packed on the host and uploaded into two device slots in turn, so the
+ * upload of the next panel overlaps with the GEMM of the current one.
+ * @param _maxDeviceBytes the device memory the tiles may use, 0 for half of
+ * the global memory of the device
+ * @return the events of the last copy of C back to the host, which has
+ * completed when the function returns
+ */
+template <typename executor_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_out_of_core(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, const element_t* a_, index_t _lda,
+    const element_t* b_, index_t _ldb, element_t _beta, element_t* _C,
+    index_t _ldc, size_t _maxDeviceBytes = 0,
+    const typename executor_t::policy_t::event_t& _dependencies = {}) {
+  using event_t = typename executor_t::policy_t::event_t;
+  ex.get_policy_handler().add_dependencies(_dependencies);
+  if (_M == 0 || _N == 0) {
+    return {};
+  }
+  if (_K == 0) {
+    internal::_scal_host_matrix(_M, _N, _beta, _C, _ldc);
+    return {};
+  }
+  auto policy_handler = ex.get_policy_handler();
+  // The whole matrices are used in place when the device shares the host
+  // memory
+  if (policy_handler.is_zero_copy(a_) && policy_handler.is_zero_copy(b_) &&
+      policy_handler.is_zero_copy(_C)) {
+    return _gemm_host(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, b_,
+                      _ldb, _beta, _C, _ldc);
+  }
+  const bool trA = (tolower(_TransA) != 'n');
+  const bool trB = (tolower(_TransB) != 'n');
+
+  // Square tiles such that two slots of A and B and the tile of C fit
+  constexpr auto global_mem_size = cl::sycl::info::device::global_mem_size;
+  const size_t maxBytes = (_maxDeviceBytes == 0)
+                              ? policy_handler.get_queue()
+                                        .get_device()
+                                        .template get_info<global_mem_size>() /
+                                    2
+                              : _maxDeviceBytes;
+  const index_t tile = std::max(
+      index_t(1),
+      static_cast<index_t>(std::sqrt(maxBytes / (5 * sizeof(element_t)))));
+  const index_t tileM = std::min(_M, tile);
+  const index_t tileN = std::min(_N, tile);
+  const index_t tileK = std::min(_K, tile);
+
+  // Copies the rows x cols block at src (leading dimension ld) to a contiguous
+  // buffer, and back
+  auto pack = [](const element_t* src, index_t ld, index_t rows, index_t cols,
+                 element_t* dst) {
+    for (index_t j = 0; j < cols; j++) {
+      std::copy(src + j * ld, src + j * ld + rows, dst + j * rows);
+    }
+  };
+  auto unpack = [](const element_t* src, index_t rows, index_t cols,
+                   element_t* dst, index_t ld) {
+    for (index_t j = 0; j < cols; j++) {
+      std::copy(src + j * rows, src + (j + 1) * rows, dst + j * ld);
+    }
+  };
+
+  auto c_gpu = make_sycl_iterator_buffer<element_t>(tileM * tileN);
+  std::vector<element_t> c_host(tileM * tileN);
+  BufferIterator<element_t, typename executor_t::policy_t> a_gpu[2] = {
+      make_sycl_iterator_buffer<element_t>(tileM * tileK),
+      make_sycl_iterator_buffer<element_t>(tileM * tileK)};
+  BufferIterator<element_t, typename executor_t::policy_t> b_gpu[2] = {
+      make_sycl_iterator_buffer<element_t>(tileK * tileN),
+      make_sycl_iterator_buffer<element_t>(tileK * tileN)};
+  std::vector<element_t> a_host[2] = {std::vector<element_t>(tileM * tileK),
+                                      std::vector<element_t>(tileM * tileK)};
+  std::vector<element_t> b_host[2] = {std::vector<element_t>(tileK * tileN),
+                                      std::vector<element_t>(tileK * tileN)};
+  // The staging buffer of a slot is only repacked once its upload is done
+  event_t uploads[2];
+  event_t ret;
+
+  for (index_t j = 0; j < _N; j += tileN) {
+    const index_t nb = std::min(tileN, _N - j);
+    for (index_t i = 0; i < _M; i += tileM) {
+      const index_t mb = std::min(tileM, _M - i);
+      // The tile is zeroed when C is not read, so that no kernel reads
+      // uninitialised memory
+      if (_beta != element_t(0)) {
+        pack(_C + i + j * _ldc, _ldc, mb, nb, c_host.data());
+        policy_handler.wait(
+            policy_handler.copy_to_device(c_host.data(), c_gpu, mb * nb));
+      } else {
+        policy_handler.fill(c_gpu, element_t(0), mb * nb);
+      }
+
+      // Packs and uploads the panels of op(A) and op(B) along K into a slot
+      auto upload = [&](index_t k, int slot) {
+        const index_t kb = std::min(tileK, _K - k);
+        policy_handler.wait(uploads[slot]);
+        if (trA) {
+          pack(a_ + k + i * _lda, _lda, kb, mb, a_host[slot].data());
+        } else {
+          pack(a_ + i + k * _lda, _lda, mb, kb, a_host[slot].data());
+        }
+        if (trB) {
+          pack(b_ + j + k * _ldb, _ldb, nb, kb, b_host[slot].data());
+        } else {
+          pack(b_ + k + j * _ldb, _ldb, kb, nb, b_host[slot].data());
+        }
+        uploads[slot] = concatenate_vectors(
+            policy_handler.copy_to_device(a_host[slot].data(), a_gpu[slot],
+                                          mb * kb),
+            policy_handler.copy_to_device(b_host[slot].data(), b_gpu[slot],
+                                          kb * nb));
+      };
+
+      upload(0, 0);
+      for (index_t k = 0, p = 0; k < _K; k += tileK, p++) {
+        const index_t kb = std::min(tileK, _K - k);
+        const int slot = p % 2;
+        if (k + tileK < _K) {
+          upload(k + tileK, 1 - slot);
+        }
+        internal::_gemm(ex, _TransA, _TransB, mb, nb, kb, _alpha, a_gpu[slot],
+                        trA ? kb : mb, b_gpu[slot], trB ? nb : kb,
+                        (k == 0) ? _beta : element_t(1), c_gpu, mb);
+      }
+
+      ret = policy_handler.copy_to_host(c_gpu, c_host.data(), mb * nb);
+      policy_handler.wait(ret);
+      unpack(c_host.data(), mb, nb, _C + i + j * _ldc, _ldc);
+    }
+  }
+  return ret;
+}
 }  // namespace blas
 #endif  // SYCL_BLAS_BLAS3_INTERFACE
@@ -0,0 +1,166 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename command_graph.h
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_COMMAND_GRAPH_H
+#define SYCL_BLAS_COMMAND_GRAPH_H
+#include <vector>
+
+#include "blas_meta.h"
+#include "container/device_scalar.h"
+#include "container/sycl_iterator.h"
+#include "policy/sycl_policy_handler.h"
+
+namespace blas {
+
+/*!
+ * @brief A sequence of BLAS calls recorded once and replayed many times.
+ *
+ * While record runs, the kernels the calls would submit are kept instead,
+ * each with its tree, launch configuration and scratch buffers. A replay then
+ * only submits the command groups, without building any view or tree again.
+ * Only calls returning events can be recorded: a call that waits for its
+ * result on the host, or copies data, would do so before anything ran.
+ *
+ * The recorded kernels keep accessing the buffers they were recorded with, so
+ * those buffers are the parameters of the graph. Their contents are bound
+ * before each replay with set_scalar, for scalars created by make_scalar and
+ * passed as the alpha of _axpy or _scal, and with set_buffer or the policy
+ * handler copies for vectors and matrices. The runtime orders these updates
+ * with the replayed kernels through the accessors.
+ * @tparam executor_t an executor using codeplay_policy
+ */
+template <typename executor_t>
+class CommandGraph {
+ public:
+  using policy_t = typename executor_t::policy_t;
+  using event_t = typename policy_t::event_t;
+  using recorded_kernel_t = typename PolicyHandler<policy_t>::recorded_kernel_t;
+
+  explicit CommandGraph(executor_t &ex) : ex_(&ex) {}
+
+  /*!
+   * @brief Records the kernels of the calls made by calls(), replacing the
+   * ones recorded before.
+   * @param calls a callable making BLAS calls on the executor of the graph
+   */
+  template <typename function_t>
+  void record(function_t calls) {
+    auto policy_handler = ex_->get_policy_handler();
+    policy_handler.start_recording();
+    try {
+      calls();
+    } catch (...) {
+      policy_handler.stop_recording();
+      throw;
+    }
+    kernels_ = policy_handler.stop_recording();
+  }
+
+  /*!
+   * @brief Submits the recorded kernels, in order.
+   * @return the events of the kernels
+   */
+  event_t replay() {
+    auto policy_handler = ex_->get_policy_handler();
+    policy_handler.flush_deferred();
+    auto q = policy_handler.get_queue();
+    event_t events;
+    events.reserve(kernels_.size());
+    for (auto &kernel : kernels_) {
+      events.push_back(policy_handler.track_event(kernel(q)));
+    }
+    return events;
+  }
+
+  /*!
+   * @brief Creates a scalar parameter, to be passed as the alpha of _axpy or
+   * _scal while recording and bound with set_scalar before each replay.
+   */
+  template <typename element_t>
+  DeviceScalar<element_t, policy_t> make_scalar(element_t value) {
+    auto data = make_sycl_iterator_buffer<element_t>(1);
+    return make_device_scalar(data, fill(data, value));
+  }
+
+  /*!
+   * @brief Sets the value a scalar parameter has in the following replays.
+   */
+  template <typename element_t>
+  event_t set_scalar(DeviceScalar<element_t, policy_t> scalar,
+                     element_t value) {
+    return fill(scalar.get_data(), value);
+  }
+
+  /*!
+   * @brief Copies size elements of value into the buffer param the graph was
+   * recorded with, on the device.
+   */
+  template <typename element_t>
+  event_t set_buffer(BufferIterator<element_t, policy_t> param,
+                     BufferIterator<element_t, policy_t> value, size_t size) {
+    auto policy_handler = ex_->get_policy_handler();
+    policy_handler.flush_deferred();
+    auto event = policy_handler.get_queue().submit([=](cl::sycl::handler &cgh) {
+      auto src =
+          get_range_accessor<cl::sycl::access::mode::read>(value, cgh, size);
+      auto dst =
+          get_range_accessor<cl::sycl::access::mode::write>(param, cgh, size);
+      cgh.copy(src, dst);
+    });
+    return {policy_handler.track_event(event)};
+  }
+
+  /*!
+   * @brief The number of kernels a replay submits.
+   */
+  size_t get_num_kernels() const { return kernels_.size(); }
+
+ private:
+  template <typename element_t>
+  event_t fill(BufferIterator<element_t, policy_t> data, element_t value) {
+    auto policy_handler = ex_->get_policy_handler();
+    policy_handler.flush_deferred();
+    auto event = policy_handler.get_queue().submit([=](cl::sycl::handler &cgh) {
+      auto acc =
+          get_range_accessor<cl::sycl::access::mode::write>(data, cgh, 1);
+      cgh.fill(acc, value);
+    });
+    return {policy_handler.track_event(event)};
+  }
+
+  executor_t *ex_;
+  std::vector<recorded_kernel_t> kernels_;
+};
+
+/*!
+ * @brief Creates an empty CommandGraph on ex, see CommandGraph.
+ */
+template <typename executor_t>
+inline CommandGraph<executor_t> make_command_graph(executor_t &ex) {
+  return CommandGraph<executor_t>(ex);
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_COMMAND_GRAPH_H
@@ -0,0 +1,65 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename deferred_interface.h
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_DEFERRED_INTERFACE_H
+#define SYCL_BLAS_DEFERRED_INTERFACE_H
+
+#include "blas_meta.h"
+#include "container/sycl_iterator.h"
+#include "executors/executor.h"
+#include "policy/sycl_policy_handler.h"
+
+namespace blas {
+namespace internal {
+
+/*!
+ * @brief Defers the element-wise call y = alpha * x (+ y when _accumulate)
+ * when the executor is deferring, see PolicyHandler::start_deferring.
+ *
+ * Only calls on buffers of the element type of alpha are deferred, so this
+ * overload, taken for every other executor and container, does nothing.
+ * @return whether the call was deferred, otherwise it has to be executed
+ */
+template <typename executor_t, typename element_t, typename container_0_t,
+          typename container_1_t, typename index_t, typename increment_t>
+inline bool _defer(executor_t &, index_t, element_t, container_0_t,
+                   increment_t, container_1_t, increment_t, bool) {
+  return false;
+}
+
+/*!
+ * @brief Adds the call to the chain of calls deferred on the executor, or
+ * submits that chain and starts a new one when the call cannot be fused
+ * with it.
+ */
+template <typename element_t, typename index_t, typename increment_t>
+bool _defer(Executor<PolicyHandler<codeplay_policy>> &ex, index_t _N,
+            element_t _alpha, BufferIterator<element_t, codeplay_policy> _vx,
+            increment_t _incx, BufferIterator<element_t, codeplay_policy> _vy,
+            increment_t _incy, bool _accumulate);
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // SYCL_BLAS_DEFERRED_INTERFACE_H
@@ -0,0 +1,90 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename generic_interface.h
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_GENERIC_INTERFACE_H
+#define SYCL_BLAS_GENERIC_INTERFACE_H
+#include "blas_meta.h"
+#include "container/device_scalar.h"
+
+namespace blas {
+
+/**
+ * \brief Reduces every element of a vector view (or of any expression tree
+ * over vector views) with a user functor, starting from _init, on the same
+ * multi-level reduction as _asum or _dot.
+ *
+ * The functor must be default constructible, combine two values with
+ * operator() and provide a constexpr static member template
+ * identity<value_t>() returning its identity element, e.g. zero for a sum.
+ * As the functor is part of the kernel type this requires the header-only
+ * build (sycl_blas.hpp).
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView or expression tree to reduce
+ * @param _op  Functor combining two values
+ * @param _init Value the reduction starts from
+ * @return The result, still on the device
+ */
+template <typename executor_t, typename view_t, typename functor_t>
+DeviceScalar<typename view_t::value_t, typename executor_t::policy_t> _reduce(
+    executor_t &ex, view_t _vx, functor_t _op, typename view_t::value_t _init);
+
+/**
+ * \brief Writes _op(x[i]) to every element i of _vout. The functor is copied
+ * to the device, so it may hold state (e.g. the maximum to subtract before an
+ * exponential). Requires the header-only build.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView or expression tree holding the input
+ * @param _vout VectorView the result is written to
+ * @param _op  Functor applied to every element
+ */
+template <typename executor_t, typename in_view_t, typename out_view_t,
+          typename functor_t>
+typename executor_t::policy_t::event_t _transform(executor_t &ex,
+                                                  in_view_t _vx,
+                                                  out_view_t _vout,
+                                                  functor_t _op);
+
+/**
+ * \brief Writes _op(x[i], y[i]) to every element i of _vout, see the single
+ * input _transform.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView or expression tree holding the first input
+ * @param _vy  VectorView or expression tree holding the second input
+ * @param _vout VectorView the result is written to
+ * @param _op  Functor applied to every pair of elements
+ */
+template <typename executor_t, typename in_view_0_t, typename in_view_1_t,
+          typename out_view_t, typename functor_t>
+typename executor_t::policy_t::event_t _transform(executor_t &ex,
+                                                  in_view_0_t _vx,
+                                                  in_view_1_t _vy,
+                                                  out_view_t _vout,
+                                                  functor_t _op);
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_GENERIC_INTERFACE_H
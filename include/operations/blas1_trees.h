@@ -62,6 +62,8 @@ struct Assign {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int width>
+  void eval_vec(index_t i);
   void bind(cl::sycl::handler &h);
 };
 
@@ -99,6 +101,8 @@ struct ScalarOp {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int width>
+  cl::sycl::vec<value_t, width> eval_vec(index_t i);
   void bind(cl::sycl::handler &h);
 };
 
@@ -132,6 +136,124 @@ struct BinaryOp {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int width>
+  cl::sycl::vec<value_t, width> eval_vec(index_t i);
+  void bind(cl::sycl::handler &h);
+};
+
+/*! FunctorOp.
+ * @brief Applies a user functor to every element of a tree. Unlike the
+ * operators of UnaryOp, the functor is stored in the node so it may carry
+ * state (e.g. a shift or a scaling factor).
+ */
+template <typename functor_t, typename rhs_t>
+struct FunctorOp {
+  using index_t = typename rhs_t::index_t;
+  using value_t = typename rhs_t::value_t;
+  functor_t functor_;
+  rhs_t rhs_;
+  FunctorOp(functor_t _functor, rhs_t &_r);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*! BinaryFunctorOp.
+ * @brief Applies a user functor to the elements of two trees, see FunctorOp.
+ */
+template <typename functor_t, typename lhs_t, typename rhs_t>
+struct BinaryFunctorOp {
+  using index_t = typename rhs_t::index_t;
+  using value_t = typename rhs_t::value_t;
+  functor_t functor_;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  BinaryFunctorOp(functor_t _functor, lhs_t &_l, rhs_t &_r);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*! RotmOp.
+ * @brief Evaluates one row of the modified Givens transformation H applied
+ * to the pair (x, y). H is read on the device from the five elements of
+ * param in the BLAS layout (flag, h11, h21, h12, h22), so it can be produced
+ * by a previous kernel (e.g. _rotmg).
+ * @tparam row 0 evaluates h11 * x + h12 * y, 1 evaluates h21 * x + h22 * y
+ */
+template <int row, typename param_t, typename lhs_t, typename rhs_t>
+struct RotmOp {
+  using index_t = typename lhs_t::index_t;
+  using value_t = typename lhs_t::value_t;
+  param_t param_;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  RotmOp(param_t &_param, lhs_t &_l, rhs_t &_r);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*! Rotmg.
+ * @brief Constructs the modified Givens transformation that zeroes the
+ * second component of (sqrt(d1) * x1, sqrt(d2) * y1), updating d1, d2 and
+ * x1 and writing the transformation to param. Everything stays on the
+ * device, the tree is evaluated by a single work item.
+ */
+template <typename d1_t, typename d2_t, typename x1_t, typename y1_t,
+          typename param_t>
+struct Rotmg {
+  using index_t = typename param_t::index_t;
+  using value_t = typename param_t::value_t;
+  d1_t d1_;
+  d2_t d2_;
+  x1_t x1_;
+  y1_t y1_;
+  param_t param_;
+  Rotmg(d1_t &_d1, d2_t &_d2, x1_t &_x1, y1_t &_y1, param_t &_param);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*! BatchedRot.
+ * @brief Applies one round of a RotationSchedule: a set of plane rotations
+ * that touch disjoint pairs of rows, so all of them can be applied by the
+ * same kernel. Work item i updates element i % N of the rows of the
+ * (i / N)-th rotation of the round, and writes both rows directly.
+ */
+template <typename vector_t, typename index_vector_t,
+          typename scalar_vector_t>
+struct BatchedRot {
+  using index_t = typename vector_t::index_t;
+  using value_t = typename vector_t::value_t;
+  vector_t vx_;
+  index_vector_t rows_i_;
+  index_vector_t rows_j_;
+  index_vector_t ids_;
+  scalar_vector_t cos_;
+  scalar_vector_t sin_;
+  index_t N_;
+  index_t inc_;
+  index_t stride_;
+  index_t begin_;
+  index_t num_rotations_;
+  BatchedRot(vector_t &_vx, index_vector_t &_rows_i, index_vector_t &_rows_j,
+             index_vector_t &_ids, scalar_vector_t &_cos,
+             scalar_vector_t &_sin, index_t _N, index_t _inc, index_t _stride,
+             index_t _begin, index_t _num_rotations);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
   void bind(cl::sycl::handler &h);
 };
 
@@ -151,6 +273,110 @@ struct TupleOp {
   void bind(cl::sycl::handler &h);
 };
 
+/*! AccumulatorOp.
+ * @brief Lifts each element to the accumulator type of a reduction operator
+ * (map (\x -> operator_t::lift(x)) vector).
+ */
+template <typename operator_t, typename rhs_t>
+struct AccumulatorOp {
+  using index_t = typename rhs_t::index_t;
+  using value_t = typename operator_t::template accumulator_t<
+      typename rhs_t::value_t>;
+  rhs_t rhs_;
+  AccumulatorOp(rhs_t &_r);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*! PairwiseOp.
+ * @brief Splits a vector into num_blocks contiguous blocks and reduces each
+ * block as a balanced binary tree, so that the rounding error of a block
+ * grows with the logarithm of its size. The block results are then combined
+ * by the tree reductions of AssignReduction.
+ */
+template <typename operator_t, typename rhs_t>
+struct PairwiseOp {
+  using index_t = typename rhs_t::index_t;
+  using value_t = typename rhs_t::value_t;
+  // Enough levels for a block of any size representable by index_t
+  static constexpr int max_levels = 8 * sizeof(index_t);
+  rhs_t rhs_;
+  index_t num_blocks_;
+  index_t block_size_;
+  PairwiseOp(rhs_t &_r, index_t _num_blocks);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*! ChunkedOp.
+ * @brief Evaluates an element-wise tree (e.g. an Assign) with a grid-stride
+ * loop in which each work item processes chunk_size elements per iteration,
+ * so the grid no longer needs one work item per element.
+ * When vectorised is true every view of the tree must have unit stride, and
+ * each chunk is loaded and stored as a cl::sycl::vec through eval_vec.
+ */
+template <typename tree_t, int chunk_size, bool vectorised>
+struct ChunkedOp {
+  using index_t = typename tree_t::index_t;
+  using value_t = typename tree_t::value_t;
+  tree_t tree_;
+  ChunkedOp(tree_t &_t);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  void eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*! DeferredOp.
+ * @brief Evaluates the element-wise calls deferred by an executor (see
+ * PolicyHandler::start_deferring) one after the other for each element.
+ * Each slot computes y = alpha * x, adding the previous y when accumulate_ is
+ * set: _axpy accumulates, _scal has x and y on the same vector and _copy has
+ * alpha one. As every slot holds views of the same type, the calls are set at
+ * run time without changing the kernel; the slots left inactive still hold a
+ * valid view so that they can be bound. It is executed through a ChunkedOp.
+ * @tparam slots the number of calls the kernel can hold
+ */
+template <typename view_t, int slots>
+struct DeferredOp {
+  using index_t = typename view_t::index_t;
+  using value_t = typename view_t::value_t;
+  view_t x_;
+  view_t y_;
+  value_t alpha_;
+  bool accumulate_;
+  bool active_;
+  DeferredOp<view_t, slots - 1> next_;
+  DeferredOp(view_t &_v);
+  void set(int slot, view_t &_x, view_t &_y, value_t _alpha, bool _accumulate);
+  index_t get_size() const;
+  void eval(index_t i);
+  template <int width>
+  void eval_vec(index_t i);
+  void bind(cl::sycl::handler &h);
+};
+
+/*! DeferredOp.
+ * @brief End of the slots of a DeferredOp.
+ */
+template <typename view_t>
+struct DeferredOp<view_t, 0> {
+  using index_t = typename view_t::index_t;
+  using value_t = typename view_t::value_t;
+  DeferredOp(view_t &_v);
+  void set(int slot, view_t &_x, view_t &_y, value_t _alpha, bool _accumulate);
+  void eval(index_t i);
+  template <int width>
+  void eval_vec(index_t i);
+  void bind(cl::sycl::handler &h);
+};
+
 /*! AssignReduction.
  * @brief Implements the reduction operation for assignments (in the form y
  * = x) with y a scalar and x a subexpression tree.
@@ -181,6 +407,34 @@ inline AssignReduction<operator_t, lhs_t, rhs_t> make_AssignReduction(
       lhs_, rhs_, local_num_thread_, global_num_thread_);
 }
 
+/*! AssignBatchedReduction.
+ * @brief Reduces every vector of a batch in its own work group, so that the
+ * whole batch is reduced by a single kernel. rhs_t is a tree over the batch
+ * seen as one vector of batch_size * vector_size elements (see
+ * BatchedVectorView) and the result of the vector b is written to lhs(b).
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t>
+struct AssignBatchedReduction {
+  using value_t = typename rhs_t::value_t;
+  using index_t = typename rhs_t::index_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  index_t vector_size_;
+  AssignBatchedReduction(lhs_t &_l, rhs_t &_r, index_t _vector_size);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT scratch, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+template <typename operator_t, typename lhs_t, typename rhs_t, typename index_t>
+inline AssignBatchedReduction<operator_t, lhs_t, rhs_t>
+make_batched_reduction(lhs_t &lhs_, rhs_t &rhs_, index_t vector_size_) {
+  return AssignBatchedReduction<operator_t, lhs_t, rhs_t>(lhs_, rhs_,
+                                                          vector_size_);
+}
+
 /*!
 @brief Template function for constructing operation nodes based on input
 template and function arguments. Non-specialized case for N reference operands.
@@ -237,6 +491,64 @@ inline TupleOp<rhs_t> make_tuple_op(rhs_t &rhs_) {
   return TupleOp<rhs_t>(rhs_);
 }
 
+template <typename operator_t, typename rhs_t>
+inline AccumulatorOp<operator_t, rhs_t> make_accumulator_op(rhs_t &rhs_) {
+  return AccumulatorOp<operator_t, rhs_t>(rhs_);
+}
+
+template <typename operator_t, typename rhs_t, typename index_t>
+inline PairwiseOp<operator_t, rhs_t> make_pairwise_op(rhs_t &rhs_,
+                                                      index_t num_blocks_) {
+  return PairwiseOp<operator_t, rhs_t>(rhs_, num_blocks_);
+}
+
+template <typename functor_t, typename rhs_t>
+inline FunctorOp<functor_t, rhs_t> make_functor_op(functor_t functor_,
+                                                   rhs_t &rhs_) {
+  return FunctorOp<functor_t, rhs_t>(functor_, rhs_);
+}
+
+template <typename functor_t, typename lhs_t, typename rhs_t>
+inline BinaryFunctorOp<functor_t, lhs_t, rhs_t> make_functor_op(
+    functor_t functor_, lhs_t &lhs_, rhs_t &rhs_) {
+  return BinaryFunctorOp<functor_t, lhs_t, rhs_t>(functor_, lhs_, rhs_);
+}
+
+template <int row, typename param_t, typename lhs_t, typename rhs_t>
+inline RotmOp<row, param_t, lhs_t, rhs_t> make_rotm_op(param_t &param_,
+                                                       lhs_t &lhs_,
+                                                       rhs_t &rhs_) {
+  return RotmOp<row, param_t, lhs_t, rhs_t>(param_, lhs_, rhs_);
+}
+
+template <typename d1_t, typename d2_t, typename x1_t, typename y1_t,
+          typename param_t>
+inline Rotmg<d1_t, d2_t, x1_t, y1_t, param_t> make_rotmg(d1_t &d1_,
+                                                         d2_t &d2_,
+                                                         x1_t &x1_,
+                                                         y1_t &y1_,
+                                                         param_t &param_) {
+  return Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>(d1_, d2_, x1_, y1_, param_);
+}
+
+template <typename vector_t, typename index_vector_t,
+          typename scalar_vector_t, typename index_t>
+inline BatchedRot<vector_t, index_vector_t, scalar_vector_t> make_batched_rot(
+    vector_t &vx_, index_vector_t &rows_i_, index_vector_t &rows_j_,
+    index_vector_t &ids_, scalar_vector_t &cos_, scalar_vector_t &sin_,
+    index_t N_, index_t inc_, index_t stride_, index_t begin_,
+    index_t num_rotations_) {
+  return BatchedRot<vector_t, index_vector_t, scalar_vector_t>(
+      vx_, rows_i_, rows_j_, ids_, cos_, sin_, N_, inc_, stride_, begin_,
+      num_rotations_);
+}
+
+template <int chunk_size, bool vectorised, typename tree_t>
+inline ChunkedOp<tree_t, chunk_size, vectorised> make_chunked_op(
+    tree_t &tree_) {
+  return ChunkedOp<tree_t, chunk_size, vectorised>(tree_);
+}
+
 }  // namespace blas
 
 #endif  // BLAS1_TREES_H
@@ -169,79 +169,454 @@ make_Gemv_Row(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
                            local_memory_size_);
 }
 
-/**** GER BY ROWS M ROWS x N BLOCK USING PROPERLY THE SHARED MEMORY ****/
-// template <typename lhs_t,typename rhs_1_t,typename rhs_2_t>
-template <bool Single, bool Lower, bool Diag, bool Upper, typename lhs_t,
+/**
+ * @struct GemvSinglePass
+ * @brief Tree node computing y = alpha * A * x + beta * y in a single kernel.
+ * Each row of A is reduced entirely by one work item (column access) or one
+ * work group (row access), so no partial sums go through global memory and
+ * alpha and beta are applied when the row is finished.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+struct GemvSinglePass {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  value_t alpha_;
+  value_t beta_;
+  index_t nWG_;
+
+  GemvSinglePass(lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+                 value_t _alpha, value_t _beta, index_t _nWG);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*!
+ @brief Generator/factory for single-pass GEMV trees.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+GemvSinglePass<lhs_t, matrix_t, vector_t> make_Gemv_Single_Pass(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::value_t alpha_, typename vector_t::value_t beta_,
+    typename vector_t::index_t nWG_) {
+  return GemvSinglePass<lhs_t, matrix_t, vector_t>(lhs_, matrix_, vector_,
+                                                   alpha_, beta_, nWG_);
+}
+
+/*!
+ * @struct GemvBatched
+ * @brief Tree node computing a batch of independent GEMVs in one kernel.
+ * The views span the whole batch and each problem starts a fixed stride after
+ * the previous one. A work group computes a whole problem at a time, a work
+ * item per row, with the blocks of x staged in local memory.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+struct GemvBatched {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  using increment_t = typename vector_t::increment_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  value_t alpha_;
+  value_t beta_;
+  increment_t incx_;
+  increment_t incy_;
+  index_t strideA_;
+  index_t stridex_;
+  index_t stridey_;
+  index_t batch_size_;
+  index_t nWG_;
+
+  GemvBatched(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, value_t _alpha,
+              value_t _beta, increment_t _incx, increment_t _incy,
+              index_t _strideA, index_t _stridex, index_t _stridey,
+              index_t _batch_size, index_t _nWG);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*!
+ @brief Generator/factory for batched GEMV trees.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+GemvBatched<lhs_t, matrix_t, vector_t> make_Gemv_Batched(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::value_t alpha_, typename vector_t::value_t beta_,
+    typename vector_t::increment_t incx_, typename vector_t::increment_t incy_,
+    typename vector_t::index_t strideA_, typename vector_t::index_t stridex_,
+    typename vector_t::index_t stridey_, typename vector_t::index_t batch_size_,
+    typename vector_t::index_t nWG_) {
+  return GemvBatched<lhs_t, matrix_t, vector_t>(
+      lhs_, matrix_, vector_, alpha_, beta_, incx_, incy_, strideA_, stridex_,
+      stridey_, batch_size_, nWG_);
+}
+
+/*!
+ * @struct GemvMultiVector
+ * @brief Tree node computing Y = alpha * A * X + beta * Y for up to
+ * max_vectors columns of X at once, so that A is read a single time. A work
+ * item computes a row for all the vectors, keeping the partial sums in
+ * registers, while the work group stages blocks of X in local memory.
+ * Columns first_ to first_ + num_ - 1 of X and Y are computed.
+ */
+template <int max_vectors, typename lhs_t, typename matrix_t, typename rhs_t>
+struct GemvMultiVector {
+  using value_t = typename rhs_t::value_t;
+  using index_t = typename rhs_t::index_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  rhs_t rhs_;
+  value_t alpha_;
+  value_t beta_;
+  index_t first_;
+  index_t num_;
+
+  GemvMultiVector(lhs_t &_l, matrix_t &_matrix, rhs_t &_rhs, value_t _alpha,
+                  value_t _beta, index_t _first, index_t _num);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*!
+ @brief Generator/factory for multi-vector GEMV trees.
+ */
+template <int max_vectors, typename lhs_t, typename matrix_t, typename rhs_t>
+GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t> make_Gemv_Multi_Vector(
+    lhs_t &lhs_, matrix_t &matrix_, rhs_t &rhs_,
+    typename rhs_t::value_t alpha_, typename rhs_t::value_t beta_,
+    typename rhs_t::index_t first_, typename rhs_t::index_t num_) {
+  return GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>(
+      lhs_, matrix_, rhs_, alpha_, beta_, first_, num_);
+}
+
+/**
+ * @struct GerTiled
+ * @brief Tree node computing the rank 1 (Single) or rank 2 updates of GER,
+ * SYR and SYR2 by 2-D tiles. A work group updates one tile, its work items
+ * running along the contiguous dimension of the matrix so that the stores are
+ * coalesced, while the vector segment of the other dimension is staged once
+ * in local memory. Tiles lying entirely outside the Lower/Upper triangle are
+ * skipped.
+ */
+template <bool Single, bool Lower, bool Upper, typename lhs_t,
           typename rhs_1_t, typename rhs_2_t>
-struct GerRow {
+struct GerTiled {
   using value_t = typename rhs_2_t::value_t;
   using index_t = typename rhs_2_t::index_t;
+
   lhs_t lhs_;
   rhs_1_t rhs_1_;
   rhs_2_t rhs_2_;
-  index_t nWG_row_;
-  index_t nWG_col_;
-  index_t local_memory_size_;
   value_t scalar_;
-  GerRow(lhs_t &_l, value_t _scl, rhs_1_t &_r1, rhs_2_t &_r2, index_t &_nWG_row,
-         index_t &_nWG_col, index_t &_shrMemSize);
+  index_t tile_size_;
+
+  GerTiled(lhs_t &_l, value_t _scl, rhs_1_t &_r1, rhs_2_t &_r2,
+           index_t _tileSize);
   index_t get_size() const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
-  value_t eval(index_t i);
-  value_t eval(cl::sycl::nd_item<1> ndItem);
   template <typename sharedT>
   value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
   void bind(cl::sycl::handler &h);
 };
 
-template <bool Single = true, bool Lower = true, bool Diag = true,
-          bool Upper = true, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
-GerRow<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t> make_Ger_Row(
+/*!
+ @brief Generator/factory for tiled GER trees.
+ @param tile_size_ extent of a tile along the dimension staged in local
+ memory, which must hold tile_size_ (Single) or 2 * tile_size_ elements
+ */
+template <bool Single = true, bool Lower = true, bool Upper = true,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+GerTiled<Single, Lower, Upper, lhs_t, rhs_1_t, rhs_2_t> make_Ger_Tiled(
     lhs_t &lhs_, typename lhs_t::value_t scalar_, rhs_1_t &rhs_1_,
-    rhs_2_t &rhs_2_, typename rhs_2_t::index_t nWG_row_,
-    typename rhs_2_t::index_t nWG_col_,
-    typename rhs_2_t::index_t local_memory_size_) {
-  return GerRow<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t>(
-      lhs_, scalar_, rhs_1_, rhs_2_, nWG_row_, nWG_col_, local_memory_size_);
+    rhs_2_t &rhs_2_, typename rhs_2_t::index_t tile_size_) {
+  return GerTiled<Single, Lower, Upper, lhs_t, rhs_1_t, rhs_2_t>(
+      lhs_, scalar_, rhs_1_, rhs_2_, tile_size_);
 }
 
-/**** GER BY COLUMNS M ROWS x N BLOCK USING PROPERLY THE SHARED MEMORY ****/
-// template <typename lhs_t,typename rhs_1_t,typename rhs_2_t>
-template <bool Single, bool Lower, bool Diag, bool Upper, typename lhs_t,
-          typename rhs_1_t, typename rhs_2_t>
-struct GerCol {
-  using value_t = typename rhs_2_t::value_t;
-  using index_t = typename rhs_2_t::index_t;
+/**
+ * @struct SymvBlocked
+ * @brief Tree node computing the partial sums of a symmetric matrix vector
+ * product reading the stored triangle once. Work group (I, J), I <= J, loads
+ * the tile (I, J) of the stored triangle in local memory and accumulates both
+ * its direct contribution, to the rows of block I, and its transposed
+ * contribution, to the rows of block J. Each partial sum is written to its
+ * own column of lhs_, so no two work groups write the same element.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+struct SymvBlocked {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
 
   lhs_t lhs_;
-  rhs_1_t rhs_1_;
-  rhs_2_t rhs_2_;
-  index_t nWG_row_;
-  index_t nWG_col_;
-  index_t local_memory_size_;
-  value_t scalar_;
+  matrix_t matrix_;
+  vector_t vector_;
+  index_t nBlocks_;
+
+  SymvBlocked(lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+              index_t _nBlocks);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*!
+ @brief Generator/factory for blocked SYMV trees.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SymvBlocked<lhs_t, matrix_t, vector_t> make_Symv_Blocked(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::index_t nBlocks_) {
+  return SymvBlocked<lhs_t, matrix_t, vector_t>(lhs_, matrix_, vector_,
+                                                nBlocks_);
+}
+
+/*!
+ * @struct Gbmv
+ * @brief Tree node computing lhs = alpha * op(A) * vector + beta * lhs for a
+ * banded matrix A with kl sub-diagonals and ku super-diagonals. The matrix
+ * view holds the band storage, A(i, j) being the element (ku + i - j, j) of
+ * it, and only the elements inside the band are read. A work item computes
+ * one element of lhs. When Unit is true the diagonal is taken to be one.
+ */
+template <bool Trans, bool Unit, typename lhs_t, typename matrix_t,
+          typename vector_t>
+struct Gbmv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  index_t kl_;
+  index_t ku_;
+  value_t alpha_;
+  value_t beta_;
+
+  Gbmv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, index_t _kl,
+       index_t _ku, value_t _alpha, value_t _beta);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*!
+ @brief Generator/factory for banded matrix vector product trees.
+ */
+template <bool Trans, bool Unit, typename lhs_t, typename matrix_t,
+          typename vector_t>
+Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t> make_Gbmv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::index_t kl_, typename vector_t::index_t ku_,
+    typename vector_t::value_t alpha_, typename vector_t::value_t beta_) {
+  return Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>(
+      lhs_, matrix_, vector_, kl_, ku_, alpha_, beta_);
+}
+
+/*!
+ * @struct Sbmv
+ * @brief Tree node computing lhs = alpha * A * vector + beta * lhs for a
+ * symmetric banded matrix A with k diagonals on each side, of which only the
+ * upper or lower triangle is stored in band storage.
+ */
+template <bool Upper, typename lhs_t, typename matrix_t, typename vector_t>
+struct Sbmv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  index_t k_;
+  value_t alpha_;
+  value_t beta_;
 
-  GerCol(lhs_t &_l, value_t _scl, rhs_1_t &_r1, rhs_2_t &_r2, index_t &_nWG_row,
-         index_t &_nWG_col, index_t &_shrMemSize);
+  Sbmv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, index_t _k,
+       value_t _alpha, value_t _beta);
   index_t get_size() const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*!
+ @brief Generator/factory for symmetric banded matrix vector product trees.
+ */
+template <bool Upper, typename lhs_t, typename matrix_t, typename vector_t>
+Sbmv<Upper, lhs_t, matrix_t, vector_t> make_Sbmv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::index_t k_, typename vector_t::value_t alpha_,
+    typename vector_t::value_t beta_) {
+  return Sbmv<Upper, lhs_t, matrix_t, vector_t>(lhs_, matrix_, vector_, k_,
+                                                alpha_, beta_);
+}
+
+/*!
+ * @struct Spmv
+ * @brief Tree node computing lhs = alpha * A * vector + beta * lhs for a
+ * symmetric matrix A of which the upper or lower triangle is packed column by
+ * column in the vector view packed_. A work item computes one element of lhs.
+ */
+template <bool Upper, typename lhs_t, typename packed_t, typename vector_t>
+struct Spmv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  packed_t packed_;
+  vector_t vector_;
+  value_t alpha_;
+  value_t beta_;
+
+  Spmv(lhs_t &_l, packed_t &_packed, vector_t &_vector, value_t _alpha,
+       value_t _beta);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*!
+ @brief Generator/factory for packed symmetric matrix vector product trees.
+ */
+template <bool Upper, typename lhs_t, typename packed_t, typename vector_t>
+Spmv<Upper, lhs_t, packed_t, vector_t> make_Spmv(
+    lhs_t &lhs_, packed_t &packed_, vector_t &vector_,
+    typename vector_t::value_t alpha_, typename vector_t::value_t beta_) {
+  return Spmv<Upper, lhs_t, packed_t, vector_t>(lhs_, packed_, vector_, alpha_,
+                                                beta_);
+}
+
+/*!
+ * @struct Tpmv
+ * @brief Tree node computing lhs = op(A) * vector for a triangular matrix A
+ * packed column by column in the vector view packed_. lhs and vector must not
+ * alias. When Unit is true the diagonal is taken to be one.
+ */
+template <bool Upper, bool Trans, bool Unit, typename lhs_t,
+          typename packed_t, typename vector_t>
+struct Tpmv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  packed_t packed_;
+  vector_t vector_;
+
+  Tpmv(lhs_t &_l, packed_t &_packed, vector_t &_vector);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*!
+ @brief Generator/factory for packed triangular matrix vector product trees.
+ */
+template <bool Upper, bool Trans, bool Unit, typename lhs_t,
+          typename packed_t, typename vector_t>
+Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t> make_Tpmv(
+    lhs_t &lhs_, packed_t &packed_, vector_t &vector_) {
+  return Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>(lhs_, packed_,
+                                                             vector_);
+}
+
+/*!
+ * @struct Spr
+ * @brief Tree node computing A = alpha * x * x^T + A for a symmetric matrix A
+ * of which the upper or lower triangle is packed in the vector view lhs_. A
+ * work item updates one stored element, so only the triangle is touched.
+ */
+template <bool Upper, typename lhs_t, typename vector_t>
+struct Spr {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  vector_t vector_;
+  value_t alpha_;
+
+  Spr(lhs_t &_l, vector_t &_vector, value_t _alpha);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t k);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+};
+
+/*!
+ @brief Generator/factory for packed symmetric rank 1 update trees.
+ */
+template <bool Upper, typename lhs_t, typename vector_t>
+Spr<Upper, lhs_t, vector_t> make_Spr(lhs_t &lhs_, vector_t &vector_,
+                                     typename vector_t::value_t alpha_) {
+  return Spr<Upper, lhs_t, vector_t>(lhs_, vector_, alpha_);
+}
+
+/*!
+ * @struct TrsvBlock
+ * @brief Tree node performing one step of a blocked triangular solve
+ * op(A) * x = b. The right-hand side is staged in rhs_, which every work
+ * group reads the diagonal block starting at blockBegin_ from and solves in
+ * local memory, one work item per row. Each group then subtracts the
+ * contribution of the solved block from its share of the rows of rhs_ that
+ * are still to be solved, while work group 0 stores the solved block in
+ * vector_. Since the block is never written back to rhs_, no group can read
+ * values solved in the same launch. Lower selects forward substitution, in
+ * which case the remaining rows are after the block, otherwise they are
+ * before it. When Unit is true the diagonal is taken to be one.
+ */
+template <bool Lower, bool Unit, typename matrix_t, typename vector_t,
+          typename rhs_t>
+struct TrsvBlock {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  matrix_t matrix_;
+  vector_t vector_;
+  rhs_t rhs_;
+  index_t blockBegin_;
+
+  TrsvBlock(matrix_t &_matrix, vector_t &_vector, rhs_t &_rhs,
+            index_t _blockBegin);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   template <typename sharedT>
   value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
   void bind(cl::sycl::handler &h);
 };
 
-// template <typename lhs_t,typename rhs_1_t,typename rhs_2_t>
-template <bool Single = true, bool Lower = true, bool Diag = true,
-          bool Upper = true, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
-GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t> make_Ger_Col(
-    lhs_t &lhs_, typename lhs_t::value_t scalar_, rhs_1_t &rhs_1_,
-    rhs_2_t &rhs_2_, typename rhs_2_t::index_t nWG_row_,
-    typename rhs_2_t::index_t nWG_col_,
-    typename rhs_2_t::index_t local_memory_size_) {
-  return GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t>(
-      lhs_, scalar_, rhs_1_, rhs_2_, nWG_row_, nWG_col_, local_memory_size_);
+/*!
+ @brief Generator/factory for blocked triangular solve steps.
+ */
+template <bool Lower, bool Unit, typename matrix_t, typename vector_t,
+          typename rhs_t>
+TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t> make_Trsv_Block(
+    matrix_t &matrix_, vector_t &vector_, rhs_t &rhs_,
+    typename vector_t::index_t blockBegin_) {
+  return TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>(
+      matrix_, vector_, rhs_, blockBegin_);
 }
 }  // namespace blas
 #endif  // BLAS2_TREES_H
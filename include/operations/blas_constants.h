@@ -41,12 +41,49 @@ struct IndexValueTuple {
   value_t val;
   index_t ind;
 
+  IndexValueTuple() = default;
   constexpr explicit IndexValueTuple(index_t _ind, value_t _val)
       : val(_val), ind(_ind){};
   SYCL_BLAS_INLINE index_t get_index() const { return ind; }
   SYCL_BLAS_INLINE value_t get_value() const { return val; }
 };
 
+/*!
+@brief Container for a partial sum of squares, kept as a scale and a scaled
+sum of squares so that the represented value (scale^2 * ssq) neither
+overflows nor underflows (see LAPACK lassq).
+*/
+template <typename scalar_t>
+struct ScaledSumSqTuple {
+  using value_t = scalar_t;
+  value_t scale;
+  value_t ssq;
+
+  ScaledSumSqTuple() = default;
+  constexpr explicit ScaledSumSqTuple(value_t _scale, value_t _ssq)
+      : scale(_scale), ssq(_ssq){};
+  SYCL_BLAS_INLINE value_t get_scale() const { return scale; }
+  SYCL_BLAS_INLINE value_t get_ssq() const { return ssq; }
+};
+
+/*!
+@brief Container for a compensated partial sum: the running sum and the
+rounding error lost while computing it (Kahan-Babuska-Neumaier summation).
+The represented value is sum + comp.
+*/
+template <typename scalar_t>
+struct CompensatedSumTuple {
+  using value_t = scalar_t;
+  value_t sum;
+  value_t comp;
+
+  CompensatedSumTuple() = default;
+  constexpr explicit CompensatedSumTuple(value_t _sum, value_t _comp)
+      : sum(_sum), comp(_comp){};
+  SYCL_BLAS_INLINE value_t get_sum() const { return sum; }
+  SYCL_BLAS_INLINE value_t get_comp() const { return comp; }
+};
+
 /*!
 @brief Enum class used to indicate a constant value associated with a type.
 */
@@ -118,6 +155,21 @@ struct constant<IndexValueTuple<value_t, index_t>, const_val::imin> {
         std::numeric_limits<value_t>::max());
   }
 };
+template <typename value_t>
+struct constant<ScaledSumSqTuple<value_t>, const_val::zero> {
+  constexpr static SYCL_BLAS_INLINE ScaledSumSqTuple<value_t> value() {
+    return ScaledSumSqTuple<value_t>(static_cast<value_t>(0),
+                                     static_cast<value_t>(1));
+  }
+};
+template <typename value_t>
+struct constant<CompensatedSumTuple<value_t>, const_val::zero> {
+  constexpr static SYCL_BLAS_INLINE CompensatedSumTuple<value_t> value() {
+    return CompensatedSumTuple<value_t>(static_cast<value_t>(0),
+                                        static_cast<value_t>(0));
+  }
+};
+
 template <typename value_t, const_val Indicator>
 struct constant<std::complex<value_t>, Indicator> {
   constexpr static SYCL_BLAS_INLINE std::complex<value_t> value() {
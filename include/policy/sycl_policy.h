@@ -88,6 +88,22 @@ struct codeplay_policy {
         .template get_info<cl::sycl::info::device::max_compute_units>();
   }
 
+  // Whether the device works in the physical memory of the host, in which
+  // case buffers can use host allocations in place
+  static inline bool has_host_unified_memory(cl::sycl::queue &q_) {
+    auto dev = q_.get_device();
+    return dev.is_host() || dev.is_cpu() ||
+           dev.template get_info<
+               cl::sycl::info::device::host_unified_memory>();
+  }
+
+  // The alignment a host allocation needs to be used in place: a cache line
+  // on CPUs, a page on integrated GPUs
+  static inline size_t get_zero_copy_alignment(cl::sycl::queue &q_) {
+    auto dev = q_.get_device();
+    return (dev.is_host() || dev.is_cpu()) ? size_t(64) : size_t(4096);
+  }
+
   static device_type find_chosen_device_type(cl::sycl::queue &q_) {
     auto dev = q_.get_device();
     auto platform = dev.get_platform();
@@ -30,17 +30,53 @@
 #include "policy/default_policy_handler.h"
 #include "policy/sycl_policy.h"
 #include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <vector>
 #include <vptr/virtual_ptr.hpp>
 
 namespace blas {
 
+/*!
+ * @brief Counters of the caching allocator of a PolicyHandler.
+ */
+struct AllocationStats {
+  // allocations served from a cached block
+  size_t hits = 0;
+  // allocations that had to create a new buffer
+  size_t misses = 0;
+  // bytes held in the free lists, ready to be reused
+  size_t bytes_cached = 0;
+};
+
 template <>
 class PolicyHandler<codeplay_policy> {
  public:
   using policy_t = codeplay_policy;
+  // A kernel recorded for a CommandGraph, submitted to the given queue
+  using recorded_kernel_t = std::function<cl::sycl::event(cl::sycl::queue)>;
 
-  explicit PolicyHandler(cl::sycl::queue q)
+  /*!
+   * @brief The element-wise calls deferred by the executors using this
+   * handler that have not been submitted yet, see start_deferring.
+   */
+  struct DeferredCalls {
+    virtual ~DeferredCalls() {}
+    // Submits the calls through the given handler, returns their events
+    virtual policy_t::event_t flush(const PolicyHandler &policy_handler) = 0;
+  };
+
+  /*!
+   * @param q the queue the trees are executed on
+   * @param cacheAllocations whether deallocated buffers are kept for reuse,
+   * see set_allocation_caching
+   */
+  explicit PolicyHandler(cl::sycl::queue q, bool cacheAllocations = false)
       : q_(q),
         pointerMapperPtr_(std::shared_ptr<cl::sycl::codeplay::PointerMapper>(
             new cl::sycl::codeplay::PointerMapper(),
@@ -51,15 +87,62 @@ class PolicyHandler<codeplay_policy> {
         workGroupSize_(codeplay_policy::get_work_group_size(q)),
         selectedDeviceType_(codeplay_policy::find_chosen_device_type(q)),
         localMemorySupport_(codeplay_policy::has_local_memory(q)),
-        computeUnits_(codeplay_policy::get_num_compute_units(q)) {}
+        computeUnits_(codeplay_policy::get_num_compute_units(q)),
+        hostUnifiedMemory_(codeplay_policy::has_host_unified_memory(q)),
+        zeroCopyAlignment_(codeplay_policy::get_zero_copy_alignment(q)),
+        cache_(std::make_shared<AllocationCache>()),
+        lookup_(std::make_shared<PointerLookupCache>()),
+        recording_(std::make_shared<Recording>()),
+        deferral_(std::make_shared<Deferral>()),
+        submissions_(std::make_shared<Submissions>()) {
+    cache_->enabled = cacheAllocations;
+  }
 
   template <typename element_t>
   element_t *allocate(size_t num_elements) const;
 
   template <typename element_t>
   void deallocate(element_t *p) const;
+
+  /*!
+   * @brief Enables or disables the caching allocator. While enabled, the
+   * blocks given back by deallocate are kept in free lists binned by size and
+   * reused by the following allocations instead of creating new buffers.
+   * Disabling it releases the cached blocks.
+   * The cache belongs to the handler, so each queue has its own arena.
+   */
+  inline void set_allocation_caching(bool enable) {
+    std::lock_guard<std::mutex> lock(cache_->mutex);
+    cache_->enabled = enable;
+    if (!enable) {
+      release_cached_blocks();
+    }
+  }
+
+  inline bool is_allocation_caching() const {
+    std::lock_guard<std::mutex> lock(cache_->mutex);
+    return cache_->enabled;
+  }
+
+  /*!
+   * @brief Returns the hit/miss counters and the bytes currently cached.
+   */
+  inline AllocationStats get_allocation_stats() const {
+    std::lock_guard<std::mutex> lock(cache_->mutex);
+    return cache_->stats;
+  }
+
+  /*!
+   * @brief Releases every cached block, the blocks still in use are kept.
+   */
+  inline void trim() {
+    std::lock_guard<std::mutex> lock(cache_->mutex);
+    release_cached_blocks();
+  }
   /*
-  @brief this class is to return the dedicated buffer to the user
+  @brief this class is to return the dedicated buffer to the user. The
+  allocations resolved most recently are remembered, so repeated calls on the
+  same data skip the search of the pointer mapper.
   @ tparam element_t is the type of the pointer
   @tparam bufferT<element_t> is the type of the buffer points to the data. on
   the host side buffer<element_t> and element_t are the same
@@ -78,6 +161,33 @@ class PolicyHandler<codeplay_policy> {
   BufferIterator<element_t, policy_t> get_buffer(
       BufferIterator<element_t, policy_t> buff) const;
 
+  /*!
+   * @brief Wraps caller-owned host memory in a buffer, so that it can be used
+   * without copy_to_device and copy_to_host. When is_zero_copy holds, the
+   * buffer uses the host memory in place. Otherwise the runtime copies the
+   * data as needed. The data is written back to the host memory when the
+   * last copy of the returned iterator is destroyed.
+   * @param ptr the host memory, which must outlive the buffer
+   * @param size the number of elements
+   */
+  template <typename element_t>
+  BufferIterator<element_t, policy_t> get_host_buffer(element_t *ptr,
+                                                      size_t size) const;
+
+  /*!
+   * @brief As above for read-only host memory, which is never written back.
+   */
+  template <typename element_t>
+  BufferIterator<element_t, policy_t> get_host_buffer(const element_t *ptr,
+                                                      size_t size) const;
+
+  /*!
+   * @brief Whether get_host_buffer uses the memory at ptr in place: the
+   * device shares the host memory and ptr is suitably aligned.
+   */
+  template <typename element_t>
+  bool is_zero_copy(const element_t *ptr) const;
+
   /*  @brief Getting range accessor from the buffer created by virtual pointer
       @tparam element_t is the type of the data
       @tparam acc_md_t is the access mode
@@ -150,6 +260,16 @@ class PolicyHandler<codeplay_policy> {
   typename policy_t::event_t copy_to_host(
       BufferIterator<element_t, policy_t> src, element_t *dst, size_t);
 
+  /*  @brief Setting the data on the device to a value, without any transfer.
+      @tparam element_t is the type of the data
+      @param dst is the BufferIterator we want to fill.
+      @param value is the value every element is set to.
+      @param size is the number of elements to be set
+  */
+  template <typename element_t>
+  typename policy_t::event_t fill(BufferIterator<element_t, policy_t> dst,
+                                  element_t value, size_t size);
+
   inline const policy_t::device_type get_device_type() const {
     return selectedDeviceType_;
   };
@@ -160,9 +280,160 @@ class PolicyHandler<codeplay_policy> {
 
   inline size_t get_num_compute_units() const { return computeUnits_; }
 
-  inline void wait() { q_.wait(); }
+  inline bool has_host_unified_memory() const { return hostUnifiedMemory_; }
+
+  /*!
+   * @brief Makes the next submission wait for the given events.
+   * The events of the command groups submitted through this handler are
+   * dropped, as their accessors on the same buffers already order the next
+   * kernels after them. SYCL 1.2.1 command groups cannot depend on events, so
+   * the remaining ones, such as host or interop events of another library,
+   * are waited for on the host.
+   */
+  inline void add_dependencies(const policy_t::event_t &events) {
+    if (events.empty()) {
+      return;
+    }
+    policy_t::event_t pending;
+    {
+      std::lock_guard<std::mutex> lock(submissions_->mutex);
+      const auto &tracked = submissions_->events;
+      for (const auto &event : events) {
+        if (std::find(tracked.begin(), tracked.end(), event) == tracked.end()) {
+          pending.push_back(event);
+        }
+      }
+    }
+    if (!pending.empty()) {
+      cl::sycl::event::wait(pending);
+    }
+  }
+
+  /*!
+   * @brief Remembers an event of a command group submitted through this
+   * handler on buffers, see add_dependencies. The completed events are
+   * forgotten, so only the ones in flight are kept.
+   */
+  inline cl::sycl::event track_event(cl::sycl::event event) {
+    std::lock_guard<std::mutex> lock(submissions_->mutex);
+    auto &tracked = submissions_->events;
+    tracked.erase(
+        std::remove_if(tracked.begin(), tracked.end(),
+                       [](const cl::sycl::event &e) {
+                         return e.get_info<
+                                    cl::sycl::info::event::
+                                        command_execution_status>() ==
+                                cl::sycl::info::event_command_status::complete;
+                       }),
+        tracked.end());
+    tracked.push_back(event);
+    return event;
+  }
+
+  /*!
+   * @brief Starts recording the kernels of the executors using this handler
+   * instead of submitting them, see CommandGraph.
+   */
+  inline void start_recording() {
+    std::lock_guard<std::mutex> lock(recording_->mutex);
+    recording_->active = true;
+    recording_->kernels.clear();
+  }
+
+  /*!
+   * @brief Stops recording and returns the kernels recorded, in order.
+   */
+  inline std::vector<recorded_kernel_t> stop_recording() {
+    // The calls deferred while recording are part of the recording
+    flush_deferred();
+    std::lock_guard<std::mutex> lock(recording_->mutex);
+    recording_->active = false;
+    std::vector<recorded_kernel_t> kernels;
+    kernels.swap(recording_->kernels);
+    return kernels;
+  }
+
+  inline bool is_recording() const {
+    std::lock_guard<std::mutex> lock(recording_->mutex);
+    return recording_->active;
+  }
 
-  inline void wait(policy_t::event_t evs) { cl::sycl::event::wait(evs); }
+  inline void record(recorded_kernel_t kernel) {
+    std::lock_guard<std::mutex> lock(recording_->mutex);
+    recording_->kernels.push_back(std::move(kernel));
+  }
+
+  /*!
+   * @brief Starts deferring the element-wise calls (_axpy, _scal, _copy) of
+   * the executors using this handler. Consecutive calls walking each buffer
+   * the same way are then submitted together as a single kernel, when any
+   * other work is submitted, the handler waits or copies data, or
+   * flush_deferred is called. A deferred call returns no event: waiting
+   * through the handler also waits for the deferred calls.
+   */
+  inline void start_deferring() {
+    std::lock_guard<std::recursive_mutex> lock(deferral_->mutex);
+    deferral_->active = true;
+  }
+
+  /*!
+   * @brief Submits the calls deferred so far and stops deferring.
+   * @return the events of the deferred calls
+   */
+  inline policy_t::event_t stop_deferring() {
+    std::lock_guard<std::recursive_mutex> lock(deferral_->mutex);
+    auto events = flush_deferred();
+    deferral_->active = false;
+    return events;
+  }
+
+  inline bool is_deferring() const {
+    std::lock_guard<std::recursive_mutex> lock(deferral_->mutex);
+    return deferral_->active;
+  }
+
+  /*!
+   * @brief Submits the calls deferred so far. Their events are also kept
+   * for the next wait.
+   * @return the events of the deferred calls, empty if there were none
+   */
+  inline policy_t::event_t flush_deferred() {
+    // The lock is taken again when the calls are submitted
+    std::lock_guard<std::recursive_mutex> lock(deferral_->mutex);
+    std::shared_ptr<DeferredCalls> calls;
+    calls.swap(deferral_->calls);
+    if (!calls) {
+      return {};
+    }
+    auto events = calls->flush(*this);
+    deferral_->submitted.insert(deferral_->submitted.end(), events.begin(),
+                                events.end());
+    return events;
+  }
+
+  /*!
+   * @brief Calls update on the calls deferred so far, which it can replace,
+   * if the handler is deferring. The state stays locked during update.
+   * @return whether the handler is deferring
+   */
+  template <typename function_t>
+  inline bool update_deferred_calls(function_t update) {
+    std::lock_guard<std::recursive_mutex> lock(deferral_->mutex);
+    if (!deferral_->active) {
+      return false;
+    }
+    update(deferral_->calls);
+    return true;
+  }
+
+  inline void wait() {
+    take_deferred_events();
+    q_.wait();
+  }
+
+  inline void wait(policy_t::event_t evs) {
+    cl::sycl::event::wait(concatenate_vectors(evs, take_deferred_events()));
+  }
 
   /*  @brief waiting for a list of sycl events
  @param first_event  and next_events are instances of sycl::sycl::event
@@ -171,7 +442,15 @@ class PolicyHandler<codeplay_policy> {
   // dont know howmany permutation can be used by a user
   template <typename first_event_t, typename... next_event_t>
   void inline wait(first_event_t first_event, next_event_t... next_events) {
-    cl::sycl::event::wait(concatenate_vectors(first_event, next_events...));
+    cl::sycl::event::wait(concatenate_vectors(first_event, next_events...,
+                                              take_deferred_events()));
+  }
+
+  // The deferred calls would be lost with the last copy of the handler
+  ~PolicyHandler() {
+    if (deferral_.use_count() == 1) {
+      flush_deferred();
+    }
   }
 
  private:
@@ -181,6 +460,122 @@ class PolicyHandler<codeplay_policy> {
   const policy_t::device_type selectedDeviceType_;
   const bool localMemorySupport_;
   const size_t computeUnits_;
+  const bool hostUnifiedMemory_;
+  const size_t zeroCopyAlignment_;
+
+  /*!
+   * @brief State of the caching allocator, shared by the copies of the
+   * handler as the pointers are.
+   */
+  struct AllocationCache {
+    std::mutex mutex;
+    bool enabled = false;
+    // free blocks, by bin size in bytes
+    std::map<size_t, std::vector<void *>> free_blocks;
+    // bin size of the blocks handed out while caching
+    std::map<void *, size_t> live_blocks;
+    AllocationStats stats;
+  };
+  std::shared_ptr<AllocationCache> cache_;
+
+  /*!
+   * @brief The allocations get_buffer and get_offset resolved most recently,
+   * shared by the copies of the handler. Entries are replaced round-robin and
+   * dropped when their allocation is freed, since the mapper can hand the
+   * same address out again.
+   */
+  struct PointerLookupCache {
+    static constexpr size_t max_entries = 4;
+    struct Entry {
+      std::uintptr_t base;
+      size_t bytes;
+      cl::sycl::codeplay::PointerMapper::buffer_t buffer;
+    };
+    std::mutex mutex;
+    std::vector<Entry> entries;
+    size_t next = 0;
+  };
+  std::shared_ptr<PointerLookupCache> lookup_;
+
+  /*!
+   * @brief The kernels recorded while a CommandGraph is being recorded.
+   */
+  struct Recording {
+    std::mutex mutex;
+    bool active = false;
+    std::vector<recorded_kernel_t> kernels;
+  };
+  std::shared_ptr<Recording> recording_;
+
+  /*!
+   * @brief Whether the element-wise calls are deferred, and the ones that
+   * have not been submitted yet.
+   */
+  struct Deferral {
+    // Recursive, as submitting the calls flushes them again
+    std::recursive_mutex mutex;
+    bool active = false;
+    std::shared_ptr<DeferredCalls> calls;
+    // The events of the calls submitted since the last wait
+    policy_t::event_t submitted;
+  };
+  std::shared_ptr<Deferral> deferral_;
+
+  /*!
+   * @brief The events of the command groups submitted through this handler
+   * that may still be in flight.
+   */
+  struct Submissions {
+    std::mutex mutex;
+    std::vector<cl::sycl::event> events;
+  };
+  std::shared_ptr<Submissions> submissions_;
+
+  /*!
+   * @brief Submits the deferred calls and returns the events of all the
+   * deferred calls submitted since the last wait, for the next wait.
+   */
+  inline policy_t::event_t take_deferred_events() {
+    std::lock_guard<std::recursive_mutex> lock(deferral_->mutex);
+    flush_deferred();
+    policy_t::event_t events;
+    events.swap(deferral_->submitted);
+    return events;
+  }
+
+  // Rounds a request up to its bin: a power of two, at least 256 bytes
+  static inline size_t get_bin_size(size_t bytes);
+  inline void *allocate_bytes(size_t bytes) const;
+  inline void deallocate_bytes(void *p) const;
+  // Returns the allocation holding ptr and the offset of ptr in bytes
+  inline cl::sycl::codeplay::PointerMapper::buffer_t lookup_pointer(
+      const void *ptr, size_t &byteOffset) const;
+  // Frees an allocation, forgetting it in the lookup cache first
+  inline void free_block(void *p) const {
+    {
+      std::lock_guard<std::mutex> lock(lookup_->mutex);
+      auto &entries = lookup_->entries;
+      const auto address = reinterpret_cast<std::uintptr_t>(p);
+      entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                   [=](const PointerLookupCache::Entry &e) {
+                                     return address >= e.base &&
+                                            address - e.base < e.bytes;
+                                   }),
+                    entries.end());
+      lookup_->next = 0;
+    }
+    cl::sycl::codeplay::SYCLfree(p, *pointerMapperPtr_);
+  }
+  // Requires the cache mutex to be held
+  inline void release_cached_blocks() const {
+    for (auto &bin : cache_->free_blocks) {
+      for (void *p : bin.second) {
+        free_block(p);
+      }
+    }
+    cache_->free_blocks.clear();
+    cache_->stats.bytes_cached = 0;
+  }
 };
 
 }  // namespace blas
@@ -0,0 +1,70 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename usm_policy.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_USM_POLICY_H
+#define SYCL_BLAS_USM_POLICY_H
+
+#ifdef SYCL_BLAS_USE_USM
+
+#include "blas_meta.h"
+#include "policy/sycl_policy.h"
+#include <CL/sycl.hpp>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief Policy in which the containers are raw device pointers allocated
+ * with SYCL unified shared memory (USM).
+ * The kernels do not create accessors, so the runtime does not track the
+ * dependencies between them: they are given as explicit lists of events.
+ */
+struct usm_policy {
+  using access_mode_t = cl::sycl::access::mode;
+  using queue_t = cl::sycl::queue;
+  using event_t = std::vector<cl::sycl::event>;
+  using device_type = codeplay_policy::device_type;
+
+  static inline bool has_local_memory(cl::sycl::queue &q_) {
+    return codeplay_policy::has_local_memory(q_);
+  }
+
+  static inline size_t get_work_group_size(cl::sycl::queue &q_) {
+    return codeplay_policy::get_work_group_size(q_);
+  }
+
+  static inline size_t get_num_compute_units(cl::sycl::queue &q_) {
+    return codeplay_policy::get_num_compute_units(q_);
+  }
+
+  static inline device_type find_chosen_device_type(cl::sycl::queue &q_) {
+    return codeplay_policy::find_chosen_device_type(q_);
+  }
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_USE_USM
+
+#endif  // SYCL_BLAS_USM_POLICY_H
@@ -0,0 +1,214 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename usm_policy_handler.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_USM_POLICY_HANDLER_H
+#define SYCL_BLAS_USM_POLICY_HANDLER_H
+
+#ifdef SYCL_BLAS_USE_USM
+
+#include "blas_meta.h"
+#include "policy/default_policy_handler.h"
+#include "policy/usm_policy.h"
+#include <CL/sycl.hpp>
+#include <memory>
+#include <mutex>
+
+namespace blas {
+
+/*!
+ * @brief Policy handler of the USM policy. The containers are the device
+ * pointers themselves, so get_buffer is the identity.
+ *
+ * Every submission made through the handler, or an executor built on it,
+ * waits for the events given to add_dependencies and for the previous
+ * submission (see set_implicit_ordering), and returns its own event. The
+ * kernels of a routine are thus ordered without any accessor, and the events
+ * let the caller order them with the rest of a USM application.
+ */
+template <>
+class PolicyHandler<usm_policy> {
+ public:
+  using policy_t = usm_policy;
+
+  explicit PolicyHandler(cl::sycl::queue q)
+      : q_(q),
+        dependencies_(std::make_shared<Dependencies>()),
+        workGroupSize_(usm_policy::get_work_group_size(q)),
+        selectedDeviceType_(usm_policy::find_chosen_device_type(q)),
+        localMemorySupport_(usm_policy::has_local_memory(q)),
+        computeUnits_(usm_policy::get_num_compute_units(q)) {}
+
+  template <typename element_t>
+  element_t *allocate(size_t num_elements) const {
+    return cl::sycl::malloc_device<element_t>(num_elements, q_);
+  }
+
+  template <typename element_t>
+  void deallocate(element_t *p) const {
+    cl::sycl::free(p, q_);
+  }
+
+  /*!
+   * @brief Frees p once the given events have completed, without blocking the
+   * host. The free is not a dependency of the following submissions.
+   */
+  template <typename element_t>
+  void deallocate_after(element_t *p, const policy_t::event_t &events) const {
+    auto q = q_;
+    q.submit([&](cl::sycl::handler &cgh) {
+      cgh.depends_on(events);
+      cgh.host_task([=]() { cl::sycl::free(p, q); });
+    });
+  }
+
+  /*!
+   * @brief Returns the container of a device pointer, the pointer itself.
+   */
+  template <typename element_t>
+  element_t *get_buffer(element_t *ptr) const {
+    return ptr;
+  }
+
+  template <typename element_t>
+  ptrdiff_t get_offset(const element_t *ptr) const {
+    return 0;
+  }
+
+  /*!
+   * @brief Adds events the next submission has to wait for. Every BLAS
+   * routine calls it with the dependencies it is given on entry.
+   * Without implicit ordering, the events replace the pending ones instead.
+   */
+  void add_dependencies(const policy_t::event_t &events) {
+    std::lock_guard<std::mutex> lock(dependencies_->mutex);
+    if (!dependencies_->implicitOrdering) {
+      dependencies_->events.clear();
+    }
+    dependencies_->events.insert(dependencies_->events.end(), events.begin(),
+                                 events.end());
+  }
+
+  /*!
+   * @brief Whether a routine waits for the submissions made before it.
+   * When disabled, a routine only waits for the dependencies it is given, so
+   * independent routines, e.g. on disjoint slices of one allocation, can run
+   * concurrently. The kernels within a routine stay ordered.
+   */
+  void set_implicit_ordering(bool enable) {
+    std::lock_guard<std::mutex> lock(dependencies_->mutex);
+    dependencies_->implicitOrdering = enable;
+  }
+
+  bool is_implicit_ordering() const {
+    std::lock_guard<std::mutex> lock(dependencies_->mutex);
+    return dependencies_->implicitOrdering;
+  }
+
+  /*!
+   * @brief Submits a command group after the pending dependencies, which are
+   * replaced by its event.
+   * @param cgf the command group, taking the SYCL handler
+   */
+  template <typename command_group_t>
+  policy_t::event_t submit(command_group_t cgf) {
+    std::lock_guard<std::mutex> lock(dependencies_->mutex);
+    auto deps = dependencies_->events;
+    auto event = q_.submit([&](cl::sycl::handler &cgh) {
+      cgh.depends_on(deps);
+      cgf(cgh);
+    });
+    dependencies_->events = {event};
+    return {event};
+  }
+
+  /*  @brief Copying the data to the device
+      @tparam element_t is the type of the data
+      @param src is the host pointer we want to copy from.
+      @param dst is the device pointer we want to copy to.
+      @param size is the number of elements to be copied
+  */
+  template <typename element_t>
+  policy_t::event_t copy_to_device(const element_t *src, element_t *dst,
+                                   size_t size) {
+    return submit([=](cl::sycl::handler &cgh) {
+      cgh.memcpy(dst, src, size * sizeof(element_t));
+    });
+  }
+
+  /*  @brief Copying the data back to the host
+      @tparam element_t is the type of the data
+      @param src is the device pointer we want to copy from.
+      @param dst is the host pointer we want to copy to.
+      @param size is the number of elements to be copied
+  */
+  template <typename element_t>
+  policy_t::event_t copy_to_host(element_t *src, element_t *dst, size_t size) {
+    return submit([=](cl::sycl::handler &cgh) {
+      cgh.memcpy(dst, src, size * sizeof(element_t));
+    });
+  }
+
+  inline const policy_t::device_type get_device_type() const {
+    return selectedDeviceType_;
+  };
+  inline bool has_local_memory() const { return localMemorySupport_; }
+  typename policy_t::queue_t get_queue() const { return q_; }
+
+  inline size_t get_work_group_size() const { return workGroupSize_; }
+
+  inline size_t get_num_compute_units() const { return computeUnits_; }
+
+  inline void wait() { q_.wait(); }
+
+  inline void wait(policy_t::event_t evs) { cl::sycl::event::wait(evs); }
+
+  template <typename first_event_t, typename... next_event_t>
+  void inline wait(first_event_t first_event, next_event_t... next_events) {
+    cl::sycl::event::wait(concatenate_vectors(first_event, next_events...));
+  }
+
+ private:
+  /*!
+   * @brief Events the next submission waits for, shared by the copies of the
+   * handler.
+   */
+  struct Dependencies {
+    std::mutex mutex;
+    bool implicitOrdering = true;
+    policy_t::event_t events;
+  };
+
+  typename policy_t::queue_t q_;
+  std::shared_ptr<Dependencies> dependencies_;
+  const size_t workGroupSize_;
+  const policy_t::device_type selectedDeviceType_;
+  const bool localMemorySupport_;
+  const size_t computeUnits_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_USE_USM
+
+#endif  // SYCL_BLAS_USM_POLICY_HANDLER_H
@@ -33,14 +33,26 @@
 
 #include "container/sycl_iterator.h"
 
+#include "container/device_scalar.h"
+
+#include "container/rotation_schedule.h"
+
 #include "executors/executor.h"
 
 #include "executors/kernel_constructor.h"
 
 #include "interface/blas1_interface.h"
 
+#include "interface/command_graph.h"
+
+#include "interface/deferred_interface.h"
+
+#include "interface/generic_interface.h"
+
 #include "types/access_types.h"
 
+#include "types/accuracy_types.h"
+
 #include "types/transposition_types.h"
 
 #include "interface/blas2_interface.h"
@@ -62,3 +74,5 @@
 #include "policy/policy_handler.h"
 
 #include "views/view.h"
+
+#include "views/view_usm.h"
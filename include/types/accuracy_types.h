@@ -0,0 +1,54 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename accuracy_types.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_ACCURACY_TYPES_H
+#define SYCL_BLAS_ACCURACY_TYPES_H
+
+namespace blas {
+
+/**
+ * @enum Accuracy
+ * @brief How the summing reductions (dot, asum) accumulate their result.
+ *
+ * standard:    sum in the element type, each work item adding a strided
+ *              slice of the input serially before the tree reduction.
+ * compensated: carry the rounding error of every addition along with the sum
+ *              (Kahan-Babuska-Neumaier), error independent of the length.
+ * pairwise:    sum contiguous blocks of the input as balanced binary trees,
+ *              then combine the blocks with the tree reductions, error
+ *              growing with log(N).
+ * wide:        accumulate float in double and round once at the end. There
+ *              is no wider type for double, nor for float without double
+ *              support: wide then behaves as compensated.
+ */
+enum class Accuracy : int {
+  standard = 0,
+  compensated = 1,
+  pairwise = 2,
+  wide = 3
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_ACCURACY_TYPES_H
@@ -180,6 +180,20 @@ void rotg(scalar_t *sa, scalar_t *sb, scalar_t *c, scalar_t *s) {
   TypeDispatcher<scalar_t>::call(&cblas_srotg, &cblas_drotg, sa, sb, c, s);
 }
 
+template <typename scalar_t>
+void rotm(const int n, scalar_t x[], const int incX, scalar_t y[],
+          const int incY, const scalar_t param[]) {
+  TypeDispatcher<scalar_t>::call(&cblas_srotm, &cblas_drotm, n, x, incX, y,
+                                 incY, param);
+}
+
+template <typename scalar_t>
+void rotmg(scalar_t *d1, scalar_t *d2, scalar_t *x1, const scalar_t y1,
+           scalar_t param[]) {
+  TypeDispatcher<scalar_t>::call(&cblas_srotmg, &cblas_drotmg, d1, d2, x1, y1,
+                                 param);
+}
+
 template <typename scalar_t>
 void scal(const int n, const scalar_t alpha, scalar_t x[], const int incX) {
   TypeDispatcher<scalar_t>::call(&cblas_sscal, &cblas_dscal, n, alpha, x, incX);
@@ -219,6 +233,14 @@ void trmv(const char *uplo, const char *trans, const char *diag, const int n,
                                  n, a, lda, x, incX);
 }
 
+template <typename scalar_t>
+void trsv(const char *uplo, const char *trans, const char *diag, const int n,
+          const scalar_t *a, const int lda, scalar_t *x, const int incX) {
+  TypeDispatcher<scalar_t>::call(&cblas_strsv, &cblas_dtrsv, CblasColMajor,
+                                 c_uplo(*uplo), c_trans(*trans), c_diag(*diag),
+                                 n, a, lda, x, incX);
+}
+
 template <typename scalar_t>
 void syr(const char *uplo, const int n, const scalar_t alpha, const scalar_t *x,
          const int incX, scalar_t *a, const int lda) {
@@ -244,6 +266,56 @@ void symv(const char *uplo, const int n, const scalar_t alpha,
                                  y, incY);
 }
 
+template <typename scalar_t>
+void gbmv(const char *trans, int m, int n, int kl, int ku, scalar_t alpha,
+          const scalar_t a[], int lda, const scalar_t x[], int incX,
+          scalar_t beta, scalar_t y[], int incY) {
+  TypeDispatcher<scalar_t>::call(&cblas_sgbmv, &cblas_dgbmv, CblasColMajor,
+                                 c_trans(*trans), m, n, kl, ku, alpha, a, lda,
+                                 x, incX, beta, y, incY);
+}
+
+template <typename scalar_t>
+void sbmv(const char *uplo, int n, int k, scalar_t alpha, const scalar_t a[],
+          int lda, const scalar_t x[], int incX, scalar_t beta, scalar_t y[],
+          int incY) {
+  TypeDispatcher<scalar_t>::call(&cblas_ssbmv, &cblas_dsbmv, CblasColMajor,
+                                 c_uplo(*uplo), n, k, alpha, a, lda, x, incX,
+                                 beta, y, incY);
+}
+
+template <typename scalar_t>
+void tbmv(const char *uplo, const char *trans, const char *diag, int n, int k,
+          const scalar_t a[], int lda, scalar_t x[], int incX) {
+  TypeDispatcher<scalar_t>::call(&cblas_stbmv, &cblas_dtbmv, CblasColMajor,
+                                 c_uplo(*uplo), c_trans(*trans), c_diag(*diag),
+                                 n, k, a, lda, x, incX);
+}
+
+template <typename scalar_t>
+void spmv(const char *uplo, int n, scalar_t alpha, const scalar_t ap[],
+          const scalar_t x[], int incX, scalar_t beta, scalar_t y[],
+          int incY) {
+  TypeDispatcher<scalar_t>::call(&cblas_sspmv, &cblas_dspmv, CblasColMajor,
+                                 c_uplo(*uplo), n, alpha, ap, x, incX, beta, y,
+                                 incY);
+}
+
+template <typename scalar_t>
+void tpmv(const char *uplo, const char *trans, const char *diag, int n,
+          const scalar_t ap[], scalar_t x[], int incX) {
+  TypeDispatcher<scalar_t>::call(&cblas_stpmv, &cblas_dtpmv, CblasColMajor,
+                                 c_uplo(*uplo), c_trans(*trans), c_diag(*diag),
+                                 n, ap, x, incX);
+}
+
+template <typename scalar_t>
+void spr(const char *uplo, int n, scalar_t alpha, const scalar_t x[], int incX,
+         scalar_t ap[]) {
+  TypeDispatcher<scalar_t>::call(&cblas_sspr, &cblas_dspr, CblasColMajor,
+                                 c_uplo(*uplo), n, alpha, x, incX, ap);
+}
+
 // =======
 // Level 3
 // =======
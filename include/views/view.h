@@ -275,6 +275,35 @@ inline
   return leaf_node_t{ex.get_policy_handler().get_buffer(buff), inc, sz};
 }
 
+/*!
+@brief A strided batch of vectors seen as a single vector of
+batch_size * vector_size elements, the element i being the element
+(i % vector_size) of the vector (i / vector_size). Lets the BLAS1 trees
+process a whole batch in a single kernel.
+@tparam view_t Unit stride view over the storage of the whole batch.
+*/
+template <typename view_t>
+struct BatchedVectorView;
+
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+inline BatchedVectorView<
+    typename VectorViewTypeFactory<typename executor_t::policy_t, container_t,
+                                   index_t, increment_t>::output_t>
+make_batched_vector_view(executor_t &ex, container_t buff, index_t vector_size,
+                         increment_t inc, index_t stride, index_t batch_size) {
+  using leaf_node_t =
+      typename VectorViewTypeFactory<typename executor_t::policy_t, container_t,
+                                     index_t, increment_t>::output_t;
+  const index_t abs_inc = (inc < 0) ? -inc : inc;
+  const index_t extent =
+      (batch_size - 1) * stride + (vector_size - 1) * abs_inc + 1;
+  return BatchedVectorView<leaf_node_t>(
+      leaf_node_t{ex.get_policy_handler().get_buffer(buff),
+                  static_cast<increment_t>(1), extent},
+      vector_size, inc, stride, batch_size);
+}
+
 template <typename executor_t, typename container_t, typename index_t,
           typename operator_t>
 inline typename MatrixViewTypeFactory<typename executor_t::policy_t,
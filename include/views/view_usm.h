@@ -0,0 +1,55 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename view_usm.h
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_VIEW_USM_H
+#define SYCL_BLAS_VIEW_USM_H
+
+#ifdef SYCL_BLAS_USE_USM
+
+#include "blas_meta.h"
+#include "policy/usm_policy.h"
+#include "views/view.h"
+
+namespace blas {
+
+/*!
+@brief With the USM policy the views hold the device pointer itself.
+*/
+template <typename element_t, typename index_t, typename increment_t>
+struct VectorViewTypeFactory<usm_policy, element_t *, index_t, increment_t> {
+  using scalar_t = typename ValueType<element_t>::type;
+  using output_t = VectorView<scalar_t, scalar_t *, index_t, increment_t>;
+};
+
+template <typename element_t, typename index_t>
+struct MatrixViewTypeFactory<usm_policy, element_t *, index_t> {
+  using scalar_t = typename ValueType<element_t>::type;
+  using output_t = MatrixView<scalar_t, scalar_t *, index_t>;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_USE_USM
+
+#endif  // SYCL_BLAS_VIEW_USM_H
@@ -26,6 +26,8 @@
 #ifndef SYCL_BLAS_EXECUTOR_SYCL_HPP
 #define SYCL_BLAS_EXECUTOR_SYCL_HPP
 
+#include <algorithm>
+
 #include "blas_meta.h"
 #include "executors/executor.h"
 #include "executors/kernel_constructor.h"
@@ -38,6 +40,28 @@ namespace blas {
  */
 template class Executor<PolicyHandler<codeplay_policy>>;
 
+/*!
+ * @brief Submits the kernel of a tree, or records it when the policy handler
+ * is recording a CommandGraph. The recorded kernel holds the tree and its
+ * launch configuration, so replaying it only submits the command group.
+ */
+template <int using_local_memory, typename expression_tree_t>
+static SYCL_BLAS_INLINE cl::sycl::event launch_tree(
+    PolicyHandler<codeplay_policy> &policy_handler, expression_tree_t t,
+    size_t localSize, size_t globalSize, size_t shMem) {
+  // The calls deferred before this tree have to be submitted before it
+  policy_handler.flush_deferred();
+  if (policy_handler.is_recording()) {
+    policy_handler.record([=](cl::sycl::queue q) {
+      return execute_tree<using_local_memory>(q, t, localSize, globalSize,
+                                              shMem);
+    });
+    return cl::sycl::event();
+  }
+  return policy_handler.track_event(execute_tree<using_local_memory>(
+      policy_handler.get_queue(), t, localSize, globalSize, shMem));
+}
+
 /*!
  * @brief Executes the tree without defining required shared memory.
  */
@@ -50,8 +74,8 @@ Executor<PolicyHandler<codeplay_policy>>::execute(expression_tree_t t) {
   auto nWG = (_N + localSize - 1) / localSize;
   auto globalSize = nWG * localSize;
 
-  return {execute_tree<using_local_memory::disabled>(
-      policy_handler_.get_queue(), t, localSize, globalSize, 0)};
+  return {launch_tree<using_local_memory::disabled>(policy_handler_, t,
+                                                   localSize, globalSize, 0)};
 };
 
 /*!
@@ -66,8 +90,8 @@ Executor<PolicyHandler<codeplay_policy>>::execute(expression_tree_t t,
   auto _N = t.get_size();
   auto nWG = (_N + localSize - 1) / localSize;
   auto globalSize = nWG * localSize;
-  return {execute_tree<using_local_memory::disabled>(
-      policy_handler_.get_queue(), t, localSize, globalSize, 0)};
+  return {launch_tree<using_local_memory::disabled>(policy_handler_, t,
+                                                   localSize, globalSize, 0)};
 };
 
 /*!
@@ -80,8 +104,8 @@ inline typename codeplay_policy::event_t
 Executor<PolicyHandler<codeplay_policy>>::execute(expression_tree_t t,
                                                   index_t localSize,
                                                   index_t globalSize) {
-  return {execute_tree<using_local_memory::disabled>(
-      policy_handler_.get_queue(), t, localSize, globalSize, 0)};
+  return {launch_tree<using_local_memory::disabled>(policy_handler_, t,
+                                                   localSize, globalSize, 0)};
 }
 
 /*!
@@ -95,12 +119,38 @@ Executor<PolicyHandler<codeplay_policy>>::execute(expression_tree_t t,
                                                   index_t localSize,
                                                   index_t globalSize,
                                                   index_t shMem) {
-  return {execute_tree<using_local_memory::enabled>(
-      policy_handler_.get_queue(), t, localSize, globalSize, shMem)};
+  return {launch_tree<using_local_memory::enabled>(
+      policy_handler_, t, localSize, globalSize, shMem)};
+}
+
+/*!
+ * @brief Executes a tree processing several elements per work item.
+ * One work item is launched per chunk of elements, up to a few work groups
+ * per compute unit; larger vectors are covered by the grid-stride loop of
+ * the tree.
+ */
+template <>
+template <typename tree_t, int chunk_size, bool vectorised>
+inline typename codeplay_policy::event_t
+Executor<PolicyHandler<codeplay_policy>>::execute(
+    ChunkedOp<tree_t, chunk_size, vectorised> t) {
+  const size_t localSize = policy_handler_.get_work_group_size();
+  const size_t maxWG = 16 * policy_handler_.get_num_compute_units();
+  const size_t _N = t.get_size();
+  auto nWG = (_N + chunk_size * localSize - 1) / (chunk_size * localSize);
+  nWG = std::max(size_t(1), std::min(nWG, maxWG));
+  auto globalSize = nWG * localSize;
+
+  return {launch_tree<using_local_memory::disabled>(policy_handler_, t,
+                                                   localSize, globalSize, 0)};
 }
 
 /*!
  * @brief Applies a reduction to a tree.
+ * Partial results are kept in the value type of the tree, which can differ
+ * from the value type of lhs_t when the operator accumulates in a wider type
+ * (e.g. ScaledSumSqOperator). In that case only the last step converts the
+ * result to the output type.
  */
 template <>
 template <typename operator_t, typename lhs_t, typename rhs_t>
@@ -108,6 +158,10 @@ inline typename codeplay_policy::event_t
 Executor<PolicyHandler<codeplay_policy>>::execute(
     AssignReduction<operator_t, lhs_t, rhs_t> t) {
   using expression_tree_t = AssignReduction<operator_t, lhs_t, rhs_t>;
+  using value_t = typename expression_tree_t::value_t;
+  using scratch_t = typename VectorViewTypeFactory<
+      codeplay_policy, BufferIterator<value_t, codeplay_policy>,
+      typename lhs_t::index_t, typename lhs_t::increment_t>::output_t;
   auto _N = t.get_size();
   auto localSize = t.local_num_thread_;
   // IF THERE ARE ENOUGH ELEMENTS, EACH BLOCK PROCESS TWO BLOCKS OF
@@ -120,10 +174,10 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
 
   // Two accessors to local memory
   auto sharedSize = ((nWG < localSize) ? localSize : nWG);
-  auto shMem1 = make_sycl_iterator_buffer<typename lhs_t::value_t>(sharedSize);
-  auto shMem2 = make_sycl_iterator_buffer<typename lhs_t::value_t>(sharedSize);
-  auto opShMem1 = lhs_t(shMem1, 1, sharedSize);
-  auto opShMem2 = lhs_t(shMem2, 1, sharedSize);
+  auto shMem1 = make_sycl_iterator_buffer<value_t>(sharedSize);
+  auto shMem2 = make_sycl_iterator_buffer<value_t>(sharedSize);
+  auto opShMem1 = scratch_t(shMem1, 1, sharedSize);
+  auto opShMem2 = scratch_t(shMem2, 1, sharedSize);
   typename codeplay_policy::event_t event;
   bool frst = true;
   bool even = false;
@@ -131,19 +185,30 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
     auto globalSize = nWG * localSize;
     if (frst) {
       // THE FIRST CASE USES THE ORIGINAL BINARY/TERNARY FUNCTION
-      auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
-                                         localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          policy_handler_.get_queue(), localTree, localSize, globalSize,
-          sharedSize));
+      if (nWG == 1) {
+        auto localTree = expression_tree_t(lhs, rhs, localSize, globalSize);
+        event.push_back(launch_tree<using_local_memory::enabled>(
+            policy_handler_, localTree, localSize, globalSize, sharedSize));
+      } else {
+        auto localTree = AssignReduction<operator_t, scratch_t, rhs_t>(
+            opShMem1, rhs, localSize, globalSize);
+        event.push_back(launch_tree<using_local_memory::enabled>(
+            policy_handler_, localTree, localSize, globalSize, sharedSize));
+      }
     } else {
       // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
-      auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
-          ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
-          (even ? opShMem1 : opShMem2), localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          policy_handler_.get_queue(), localTree, localSize, globalSize,
-          sharedSize));
+      auto &input = even ? opShMem1 : opShMem2;
+      if (nWG == 1) {
+        auto localTree = AssignReduction<operator_t, lhs_t, scratch_t>(
+            lhs, input, localSize, globalSize);
+        event.push_back(launch_tree<using_local_memory::enabled>(
+            policy_handler_, localTree, localSize, globalSize, sharedSize));
+      } else {
+        auto localTree = AssignReduction<operator_t, scratch_t, scratch_t>(
+            (even ? opShMem2 : opShMem1), input, localSize, globalSize);
+        event.push_back(launch_tree<using_local_memory::enabled>(
+            policy_handler_, localTree, localSize, globalSize, sharedSize));
+      }
     }
     _N = nWG;
     nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
@@ -187,17 +252,15 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
       // THE FIRST CASE USES THE ORIGINAL BINARY/TERNARY FUNCTION
       auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
                                          localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          policy_handler_.get_queue(), localTree, localSize, globalSize,
-          sharedSize));
+      event.push_back(launch_tree<using_local_memory::enabled>(
+          policy_handler_, localTree, localSize, globalSize, sharedSize));
     } else {
       // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
       auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
           ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
           (even ? opShMem1 : opShMem2), localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          policy_handler_.get_queue(), localTree, localSize, globalSize,
-          sharedSize));
+      event.push_back(launch_tree<using_local_memory::enabled>(
+          policy_handler_, localTree, localSize, globalSize, sharedSize));
     }
     _N = nWG;
     nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
@@ -220,10 +283,10 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
            TransA, TransB, element_t, is_beta_zero,
            Gemm_type>::get_nd_range(gemm_tree.m_, gemm_tree.n_,
                                     policy_handler_.get_num_compute_units());
-  return {execute_tree<
+  return {launch_tree<
       Choose<Gemm_type == static_cast<int>(Gemm_t::local_memory),
              using_local_memory::enabled, using_local_memory::disabled>::type>(
-      policy_handler_.get_queue(), gemm_tree, rng.get_local_range()[0],
+      policy_handler_, gemm_tree, rng.get_local_range()[0],
       rng.get_global_range()[0],
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero,
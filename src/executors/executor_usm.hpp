@@ -0,0 +1,242 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename executor_usm.hpp
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_EXECUTOR_USM_HPP
+#define SYCL_BLAS_EXECUTOR_USM_HPP
+
+#ifdef SYCL_BLAS_USE_USM
+
+#include <algorithm>
+
+#include "blas_meta.h"
+#include "executors/executor.h"
+#include "executors/kernel_constructor.h"
+#include "policy/usm_policy_handler.h"
+#include "views/view_usm.h"
+
+namespace blas {
+/*! Executor<PolicyHandler<usm_policy>>.
+ * @brief Executes an Expression expression_tree_t on USM pointers.
+ */
+template class Executor<PolicyHandler<usm_policy>>;
+
+/*!
+ * @brief Submits the kernel of a tree after the dependencies of the policy
+ * handler. No accessor is created, so this is the only ordering between the
+ * kernels.
+ */
+template <int using_local_memory, typename expression_tree_t>
+static SYCL_BLAS_INLINE typename usm_policy::event_t submit_tree(
+    PolicyHandler<usm_policy> &policy_handler, expression_tree_t t,
+    size_t localSize, size_t globalSize, size_t shMem) {
+  using value_t =
+      typename LocalMemoryType<using_local_memory, expression_tree_t>::type;
+  return policy_handler.submit([=](cl::sycl::handler &h) mutable {
+    auto scratch = LocalMemory<value_t, using_local_memory>(shMem, h);
+
+    cl::sycl::nd_range<1> gridConfiguration = cl::sycl::nd_range<1>{
+        cl::sycl::range<1>{globalSize}, cl::sycl::range<1>{localSize}};
+    h.parallel_for(
+        gridConfiguration,
+        ExpressionTreeFunctor<using_local_memory, expression_tree_t,
+                              decltype(scratch), value_t>(scratch, t));
+  });
+}
+
+/*!
+ * @brief Executes the tree without defining required shared memory.
+ */
+template <>
+template <typename expression_tree_t>
+inline typename usm_policy::event_t
+Executor<PolicyHandler<usm_policy>>::execute(expression_tree_t t) {
+  const auto localSize = policy_handler_.get_work_group_size();
+  auto _N = t.get_size();
+  auto nWG = (_N + localSize - 1) / localSize;
+  auto globalSize = nWG * localSize;
+
+  return submit_tree<using_local_memory::disabled>(policy_handler_, t,
+                                                   localSize, globalSize, 0);
+};
+
+/*!
+ * @brief Executes the tree fixing the localSize but without defining
+ * required shared memory.
+ */
+template <>
+template <typename expression_tree_t, typename index_t>
+inline typename usm_policy::event_t
+Executor<PolicyHandler<usm_policy>>::execute(expression_tree_t t,
+                                             index_t localSize) {
+  auto _N = t.get_size();
+  auto nWG = (_N + localSize - 1) / localSize;
+  auto globalSize = nWG * localSize;
+  return submit_tree<using_local_memory::disabled>(policy_handler_, t,
+                                                   localSize, globalSize, 0);
+};
+
+/*!
+ * @brief Executes the tree fixing the localSize but without defining
+ * required shared memory.
+ */
+template <>
+template <typename expression_tree_t, typename index_t>
+inline typename usm_policy::event_t
+Executor<PolicyHandler<usm_policy>>::execute(expression_tree_t t,
+                                             index_t localSize,
+                                             index_t globalSize) {
+  return submit_tree<using_local_memory::disabled>(policy_handler_, t,
+                                                   localSize, globalSize, 0);
+}
+
+/*!
+ * @brief Executes the tree with specific local, global and shared
+ * memory values.
+ */
+template <>
+template <typename expression_tree_t, typename index_t>
+inline typename usm_policy::event_t
+Executor<PolicyHandler<usm_policy>>::execute(expression_tree_t t,
+                                             index_t localSize,
+                                             index_t globalSize,
+                                             index_t shMem) {
+  return submit_tree<using_local_memory::enabled>(policy_handler_, t,
+                                                  localSize, globalSize, shMem);
+}
+
+/*!
+ * @brief Executes a tree processing several elements per work item.
+ * See the codeplay_policy version.
+ */
+template <>
+template <typename tree_t, int chunk_size, bool vectorised>
+inline typename usm_policy::event_t
+Executor<PolicyHandler<usm_policy>>::execute(
+    ChunkedOp<tree_t, chunk_size, vectorised> t) {
+  const size_t localSize = policy_handler_.get_work_group_size();
+  const size_t maxWG = 16 * policy_handler_.get_num_compute_units();
+  const size_t _N = t.get_size();
+  auto nWG = (_N + chunk_size * localSize - 1) / (chunk_size * localSize);
+  nWG = std::max(size_t(1), std::min(nWG, maxWG));
+  auto globalSize = nWG * localSize;
+
+  return submit_tree<using_local_memory::disabled>(policy_handler_, t,
+                                                   localSize, globalSize, 0);
+}
+
+/*!
+ * @brief Applies a reduction to a tree, see the codeplay_policy version.
+ * The partial results of the steps are kept in a device allocation, freed
+ * once the last step has completed.
+ */
+template <>
+template <typename operator_t, typename lhs_t, typename rhs_t>
+inline typename usm_policy::event_t
+Executor<PolicyHandler<usm_policy>>::execute(
+    AssignReduction<operator_t, lhs_t, rhs_t> t) {
+  using expression_tree_t = AssignReduction<operator_t, lhs_t, rhs_t>;
+  using value_t = typename expression_tree_t::value_t;
+  using scratch_t = typename VectorViewTypeFactory<
+      usm_policy, value_t *, typename lhs_t::index_t,
+      typename lhs_t::increment_t>::output_t;
+  auto _N = t.get_size();
+  auto localSize = t.local_num_thread_;
+  auto nWG = (t.global_num_thread_ + (2 * localSize) - 1) / (2 * localSize);
+  auto lhs = t.lhs_;
+  auto rhs = t.rhs_;
+
+  auto sharedSize = ((nWG < localSize) ? localSize : nWG);
+  auto scratch = policy_handler_.template allocate<value_t>(2 * sharedSize);
+  auto opShMem1 = scratch_t(scratch, 1, sharedSize);
+  auto opShMem2 = scratch_t(scratch + sharedSize, 1, sharedSize);
+  typename usm_policy::event_t event;
+  bool frst = true;
+  bool even = false;
+  do {
+    auto globalSize = nWG * localSize;
+    if (frst) {
+      if (nWG == 1) {
+        auto localTree = expression_tree_t(lhs, rhs, localSize, globalSize);
+        event = submit_tree<using_local_memory::enabled>(
+            policy_handler_, localTree, localSize, globalSize, sharedSize);
+      } else {
+        auto localTree = AssignReduction<operator_t, scratch_t, rhs_t>(
+            opShMem1, rhs, localSize, globalSize);
+        event = submit_tree<using_local_memory::enabled>(
+            policy_handler_, localTree, localSize, globalSize, sharedSize);
+      }
+    } else {
+      auto &input = even ? opShMem1 : opShMem2;
+      if (nWG == 1) {
+        auto localTree = AssignReduction<operator_t, lhs_t, scratch_t>(
+            lhs, input, localSize, globalSize);
+        event = submit_tree<using_local_memory::enabled>(
+            policy_handler_, localTree, localSize, globalSize, sharedSize);
+      } else {
+        auto localTree = AssignReduction<operator_t, scratch_t, scratch_t>(
+            (even ? opShMem2 : opShMem1), input, localSize, globalSize);
+        event = submit_tree<using_local_memory::enabled>(
+            policy_handler_, localTree, localSize, globalSize, sharedSize);
+      }
+    }
+    _N = nWG;
+    nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
+    frst = false;
+    even = !even;
+  } while (_N > 1);
+  // Each step waits for the previous one, so the last event completes the
+  // reduction
+  policy_handler_.deallocate_after(scratch, event);
+  return event;
+}
+
+/*!
+ * @brief Executes a GEMM tree, see the codeplay_policy version.
+ */
+template <>
+template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
+          bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
+          typename element_t, bool is_beta_zero, int Gemm_type>
+inline typename usm_policy::event_t
+Executor<PolicyHandler<usm_policy>>::execute(
+    Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
+         TransB, element_t, is_beta_zero, Gemm_type>
+        gemm_tree) {
+  using gemm_t = Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
+                      tile_type, TransA, TransB, element_t, is_beta_zero,
+                      Gemm_type>;
+  auto rng = gemm_t::get_nd_range(gemm_tree.m_, gemm_tree.n_,
+                                  policy_handler_.get_num_compute_units());
+  return submit_tree<
+      Choose<Gemm_type == static_cast<int>(Gemm_t::local_memory),
+             using_local_memory::enabled, using_local_memory::disabled>::type>(
+      policy_handler_, gemm_tree, rng.get_local_range()[0],
+      rng.get_global_range()[0], gemm_t::local_memory_size);
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_USE_USM
+
+#endif  // SYCL_BLAS_EXECUTOR_USM_HPP
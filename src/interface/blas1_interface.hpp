@@ -26,21 +26,159 @@
 #ifndef SYCL_BLAS_BLAS1_INTERFACE_HPP
 #define SYCL_BLAS_BLAS1_INTERFACE_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
 #include <vector>
 
 #include "blas_meta.h"
+#include "container/device_scalar.h"
+#include "container/rotation_schedule.h"
 #include "container/sycl_iterator.h"
 #include "executors/executor.h"
 #include "interface/blas1_interface.h"
+#include "interface/deferred_interface.h"
 #include "operations/blas1_trees.h"
 #include "operations/blas_constants.h"
 #include "operations/blas_operators.hpp"
 
 namespace blas {
 namespace internal {
+/**
+ * \brief The reductions returning their result, on the host or in a
+ * DeviceScalar, keep it in a buffer and thus require codeplay_policy.
+ */
+template <typename executor_t>
+inline void check_buffer_result() {
+  static_assert(
+      std::is_same<typename executor_t::policy_t, codeplay_policy>::value,
+      "This reduction keeps its result in a buffer and requires "
+      "codeplay_policy. With usm_policy, pass a device pointer for the "
+      "result instead.");
+}
+
+/**
+ * \brief Returns the operand used for a scalar parameter of a ScalarOp.
+ * Host scalars are captured by value in the kernel.
+ */
+template <typename index_t, typename increment_t, typename executor_t,
+          typename element_t>
+inline element_t make_scalar_operand(executor_t &, element_t _alpha) {
+  return _alpha;
+}
+
+/**
+ * \brief A DeviceScalar is read on the device through a one element view, so
+ * no host synchronisation is needed before using it.
+ */
+template <typename index_t, typename increment_t, typename executor_t,
+          typename element_t, typename policy_t>
+inline auto make_scalar_operand(executor_t &ex,
+                                DeviceScalar<element_t, policy_t> _alpha)
+    -> decltype(make_vector_view(ex, _alpha.get_data(),
+                                 static_cast<increment_t>(1),
+                                 static_cast<index_t>(1))) {
+  return make_vector_view(ex, _alpha.get_data(), static_cast<increment_t>(1),
+                          static_cast<index_t>(1));
+}
+
+/**
+ * \brief Executes an element-wise tree with several elements per work item.
+ * When every vector of the tree is contiguous the elements are read and
+ * written with vector loads and stores, otherwise one by one.
+ */
+template <typename executor_t, typename tree_t>
+typename executor_t::policy_t::event_t _execute_chunked(executor_t &ex,
+                                                        tree_t tree,
+                                                        bool unit_stride) {
+  static constexpr int chunk_size = 4;
+  if (unit_stride) {
+    auto chunkedOp = make_chunked_op<chunk_size, true>(tree);
+    return ex.execute(chunkedOp);
+  }
+  auto chunkedOp = make_chunked_op<chunk_size, false>(tree);
+  return ex.execute(chunkedOp);
+}
+
+/**
+ * \brief Launches the tree reductions summing terms into rs with operator_t,
+ * on a grid of 2 * localSize work groups.
+ */
+template <typename operator_t, typename executor_t, typename lhs_t,
+          typename rhs_t>
+typename executor_t::policy_t::event_t _add_reduction(executor_t &ex,
+                                                      lhs_t rs, rhs_t terms) {
+  const size_t localSize = ex.get_policy_handler().get_work_group_size();
+  const size_t nWG = 2 * localSize;
+  auto assignOp =
+      make_AssignReduction<operator_t>(rs, terms, localSize, localSize * nWG);
+  return ex.execute(assignOp);
+}
+
+/**
+ * \brief Sums the terms of a summing reduction (dot, asum) into rs, using the
+ * accumulation strategy selected by accuracy. Each strategy is a
+ * specialisation, so only the kernels of the selected one are instantiated.
+ */
+template <Accuracy accuracy>
+struct SumReduction;
+
+template <>
+struct SumReduction<Accuracy::standard> {
+  template <typename executor_t, typename lhs_t, typename rhs_t>
+  static typename executor_t::policy_t::event_t run(executor_t &ex, lhs_t rs,
+                                                    rhs_t terms) {
+    return _add_reduction<AddOperator>(ex, rs, terms);
+  }
+};
+
+template <>
+struct SumReduction<Accuracy::compensated> {
+  template <typename executor_t, typename lhs_t, typename rhs_t>
+  static typename executor_t::policy_t::event_t run(executor_t &ex, lhs_t rs,
+                                                    rhs_t terms) {
+    auto compOp = make_accumulator_op<CompensatedAddOperator>(terms);
+    return _add_reduction<CompensatedAddOperator>(ex, rs, compOp);
+  }
+};
+
+template <>
+struct SumReduction<Accuracy::pairwise> {
+  template <typename executor_t, typename lhs_t, typename rhs_t>
+  static typename executor_t::policy_t::event_t run(executor_t &ex, lhs_t rs,
+                                                    rhs_t terms) {
+    // One block per term read by the first reduction, which then adds a single
+    // pair of blocks per work item. Every addition is part of a balanced tree
+    // and the scratch is bounded by the grid, whatever the size.
+    using index_t = typename rhs_t::index_t;
+    const index_t localSize =
+        static_cast<index_t>(ex.get_policy_handler().get_work_group_size());
+    const index_t maxBlocks = 4 * localSize * localSize;
+    const index_t size = terms.get_size();
+    const index_t numBlocks =
+        std::max(index_t(1), std::min(size, maxBlocks));
+    auto pairOp = make_pairwise_op<AddOperator>(terms, numBlocks);
+    return _add_reduction<AddOperator>(ex, rs, pairOp);
+  }
+};
+
+template <>
+struct SumReduction<Accuracy::wide> {
+  template <typename executor_t, typename lhs_t, typename rhs_t>
+  static typename executor_t::policy_t::event_t run(executor_t &ex, lhs_t rs,
+                                                    rhs_t terms) {
+    // Without a wider type, wide behaves as compensated
+    using element_t = typename rhs_t::value_t;
+    using operator_t = typename std::conditional<
+        std::is_same<typename WideAccumulator<element_t>::type,
+                     element_t>::value,
+        CompensatedAddOperator, WideAddOperator>::type;
+    auto wideOp = make_accumulator_op<operator_t>(terms);
+    return _add_reduction<operator_t>(ex, rs, wideOp);
+  }
+};
+
 /**
  * \brief AXPY constant times a vector plus a vector.
  *
@@ -57,13 +195,17 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _axpy(
     executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy) {
+  if (_defer(ex, _N, _alpha, _vx, _incx, _vy, _incy, true)) {
+    return {};
+  }
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto vy = make_vector_view(ex, _vy, _incy, _N);
 
-  auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
+  auto scalOp = make_op<ScalarOp, ProductOperator>(
+      make_scalar_operand<index_t, increment_t>(ex, _alpha), vx);
   auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
   auto assignOp = make_op<Assign>(vy, addOp);
-  auto ret = ex.execute(assignOp);
+  auto ret = _execute_chunked(ex, assignOp, _incx == 1 && _incy == 1);
   return ret;
 }
 
@@ -83,10 +225,14 @@ typename executor_t::policy_t::event_t _copy(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
+  using element_t = typename ValueType<container_0_t>::type;
+  if (_defer(ex, _N, element_t(1), _vx, _incx, _vy, _incy, false)) {
+    return {};
+  }
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto vy = make_vector_view(ex, _vy, _incy, _N);
   auto assignOp2 = make_op<Assign>(vy, vx);
-  auto ret = ex.execute(assignOp2);
+  auto ret = _execute_chunked(ex, assignOp2, _incx == 1 && _incy == 1);
   return ret;
 }
 
@@ -98,24 +244,24 @@ typename executor_t::policy_t::event_t _copy(executor_t &ex, index_t _N,
  * @param _incx Increment in X axis
  * @param _vx  VectorView
  * @param _incy Increment in Y axis
+ * @tparam accuracy How the products are accumulated
  */
-template <typename executor_t, typename container_0_t, typename container_1_t,
-          typename container_2_t, typename index_t, typename increment_t>
-typename executor_t::policy_t::event_t _dot(
-    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
-    container_1_t _vy, increment_t _incy, container_2_t _rs) {
+template <Accuracy accuracy, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _dot(executor_t &ex, index_t _N,
+                                            container_0_t _vx,
+                                            increment_t _incx,
+                                            container_1_t _vy,
+                                            increment_t _incy,
+                                            container_2_t _rs) {
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto vy = make_vector_view(ex, _vy, _incy, _N);
   auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
                              static_cast<index_t>(1));
   auto prdOp = make_op<BinaryOp, ProductOperator>(vx, vy);
 
-  auto localSize = ex.get_policy_handler().get_work_group_size();
-  auto nWG = 2 * localSize;
-
-  auto assignOp =
-      make_AssignReduction<AddOperator>(rs, prdOp, localSize, localSize * nWG);
-  auto ret = ex.execute(assignOp);
+  auto ret = SumReduction<accuracy>::run(ex, rs, prdOp);
   return ret;
 }
 
@@ -124,9 +270,10 @@ typename executor_t::policy_t::event_t _dot(
  * @param executor_t<ExecutorType> ex
  * @param _vx  VectorView
  * @param _incx Increment in X axis
+ * @tparam accuracy How the absolute values are accumulated
  */
-template <typename executor_t, typename container_0_t, typename container_1_t,
-          typename index_t, typename increment_t>
+template <Accuracy accuracy, typename executor_t, typename container_0_t,
+          typename container_1_t, typename index_t, typename increment_t>
 typename executor_t::policy_t::event_t _asum(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
@@ -134,12 +281,9 @@ typename executor_t::policy_t::event_t _asum(executor_t &ex, index_t _N,
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
                              static_cast<index_t>(1));
+  auto absOp = make_op<UnaryOp, AbsoluteValue>(vx);
 
-  const auto localSize = ex.get_policy_handler().get_work_group_size();
-  const auto nWG = 2 * localSize;
-  auto assignOp = make_AssignReduction<AbsoluteAddOperator>(rs, vx, localSize,
-                                                            localSize * nWG);
-  auto ret = ex.execute(assignOp);
+  auto ret = SumReduction<accuracy>::run(ex, rs, absOp);
   return ret;
 }
 
@@ -226,15 +370,25 @@ typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
                                              element_t _alpha,
                                              container_0_t _vx,
                                              increment_t _incx) {
+  if (_defer(ex, _N, _alpha, _vx, _incx, _vx, _incx, false)) {
+    return {};
+  }
   auto vx = make_vector_view(ex, _vx, _incx, _N);
-  auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
+  auto scalOp = make_op<ScalarOp, ProductOperator>(
+      make_scalar_operand<index_t, increment_t>(ex, _alpha), vx);
   auto assignOp = make_op<Assign>(vx, scalOp);
-  auto ret = ex.execute(assignOp);
+  auto ret = _execute_chunked(ex, assignOp, _incx == 1);
   return ret;
 }
 
 /**
  * \brief NRM2 Returns the euclidian norm of a vector
+ *
+ * Vectors of up to 64 work groups' worth of elements are reduced by a single
+ * work group, in one launch. Longer vectors take a second launch reducing the
+ * partial results of each work group, as SYCL 1.2.1 has no floating point
+ * atomics to combine them in the first one. In both cases the square root is
+ * taken by the final write, without a separate pass.
  * @param executor_t<ExecutorType> ex
  * @param _vx  VectorView
  * @param _incx Increment in X axis
@@ -248,17 +402,19 @@ typename executor_t::policy_t::event_t _nrm2(executor_t &ex, index_t _N,
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
                              static_cast<index_t>(1));
-  auto prdOp = make_op<UnaryOp, SquareOperator>(vx);
+  // The squares are accumulated as (scale, ssq) pairs to avoid overflow and
+  // underflow, the square root is taken when writing the final result
+  auto ssqOp = make_accumulator_op<ScaledSumSqOperator>(vx);
 
   const auto localSize = ex.get_policy_handler().get_work_group_size();
-  const auto nWG = 2 * localSize;
-  auto assignOp =
-      make_AssignReduction<AddOperator>(rs, prdOp, localSize, localSize * nWG);
-  auto ret0 = ex.execute(assignOp);
-  auto sqrtOp = make_op<UnaryOp, SqrtOperator>(rs);
-  auto assignOpFinal = make_op<Assign>(rs, sqrtOp);
-  auto ret1 = ex.execute(assignOpFinal);
-  return blas::concatenate_vectors(ret0, ret1);
+  // A single work group is enough for short vectors, whose reduction is
+  // dominated by the launch latency
+  const auto nWG =
+      (static_cast<size_t>(_N) <= 64 * localSize) ? size_t(1) : 2 * localSize;
+  auto assignOp = make_AssignReduction<ScaledSumSqOperator>(
+      rs, ssqOp, localSize, localSize * nWG);
+  auto ret = ex.execute(assignOp);
+  return ret;
 }
 
 /**
@@ -293,6 +449,115 @@ typename executor_t::policy_t::event_t _rot(
   return ret;
 }
 
+/**
+ * @brief _rotm applies the modified Givens transformation H to the pair of
+ * vectors (x, y). H is read on the device from _param, so both rows are
+ * evaluated by the same DoubleAssign kernel whatever the flag is.
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _param Buffer holding the transformation
+ * @param _N data size
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _rotm(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, container_2_t _param) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto param = make_vector_view(ex, _param, static_cast<increment_t>(1),
+                                static_cast<index_t>(5));
+  auto rotmOp0 = make_rotm_op<0>(param, vx, vy);
+  auto rotmOp1 = make_rotm_op<1>(param, vx, vy);
+  auto DoubleAssignView = make_op<DoubleAssign>(vx, vy, rotmOp0, rotmOp1);
+  auto ret = ex.execute(DoubleAssignView);
+  return ret;
+}
+
+/**
+ * @brief _rotmg constructs the modified Givens transformation on the device.
+ * The algorithm is inherently serial, so it is evaluated by a single work
+ * item; keeping it on the device avoids synchronising with the host before
+ * the transformation is applied.
+ * @param executor_t<ExecutorType> ex
+ * @param _d1 Scaling factor of x1, updated in place
+ * @param _d2 Scaling factor of y1, updated in place
+ * @param _x1 First component, updated in place
+ * @param _y1 Second component
+ * @param _param Buffer receiving the transformation
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t>
+typename executor_t::policy_t::event_t _rotmg(executor_t &ex,
+                                              container_0_t _d1,
+                                              container_1_t _d2,
+                                              container_2_t _x1,
+                                              container_3_t _y1,
+                                              container_4_t _param) {
+  auto d1 = make_vector_view(ex, _d1, 1, 1);
+  auto d2 = make_vector_view(ex, _d2, 1, 1);
+  auto x1 = make_vector_view(ex, _x1, 1, 1);
+  auto y1 = make_vector_view(ex, _y1, 1, 1);
+  auto param = make_vector_view(ex, _param, 1, 5);
+  auto rotmgOp = make_rotmg(d1, d2, x1, y1, param);
+  auto ret = ex.execute(rotmgOp, 1, 1);
+  return ret;
+}
+
+/**
+ * @brief _rot_batched applies a sequence of plane rotations to pairs of rows
+ * of x. The rotations of a round touch disjoint rows, so each round is applied
+ * by a single kernel with one work item per updated pair of elements, instead
+ * of one _rot launch per rotation.
+ * @param executor_t<ExecutorType> ex
+ * @param _M Number of rows
+ * @param _N Size of each row
+ * @param _vx  VectorView
+ * @param _incx Increment between two elements of a row
+ * @param _stridex Distance between the first elements of two rows
+ * @param _schedule Rows of each rotation, grouped into rounds
+ * @param _cos Cosine of each rotation, in the original order
+ * @param _sin Sine of each rotation, in the original order
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _rot_batched(
+    executor_t &ex, index_t _M, index_t _N, container_0_t _vx,
+    increment_t _incx, index_t _stridex,
+    const RotationSchedule<index_t, typename executor_t::policy_t> &_schedule,
+    container_1_t _cos, container_1_t _sin) {
+  typename executor_t::policy_t::event_t ret;
+  if (_N == 0 || _schedule.get_num_rounds() == 0) {
+    return ret;
+  }
+  const index_t num_rotations =
+      _schedule.get_round_begin(_schedule.get_num_rounds());
+  auto vx = make_vector_view(ex, _vx, static_cast<increment_t>(1),
+                             _stridex * _M);
+  auto rows_i = make_vector_view(ex, _schedule.get_rows_i(),
+                                 static_cast<increment_t>(1), num_rotations);
+  auto rows_j = make_vector_view(ex, _schedule.get_rows_j(),
+                                 static_cast<increment_t>(1), num_rotations);
+  auto ids = make_vector_view(ex, _schedule.get_ids(),
+                              static_cast<increment_t>(1), num_rotations);
+  auto vcos = make_vector_view(ex, _cos, static_cast<increment_t>(1),
+                               num_rotations);
+  auto vsin = make_vector_view(ex, _sin, static_cast<increment_t>(1),
+                               num_rotations);
+  for (index_t r = 0; r < _schedule.get_num_rounds(); r++) {
+    auto rotOp = make_batched_rot(
+        vx, rows_i, rows_j, ids, vcos, vsin, _N, static_cast<index_t>(_incx),
+        _stridex, _schedule.get_round_begin(r), _schedule.get_round_size(r));
+    auto event = ex.execute(rotOp);
+    ret.insert(ret.end(), event.begin(), event.end());
+  }
+  return ret;
+}
+
 /**
  * \brief Compute the inner product of two vectors with extended
     precision accumulation and result.
@@ -302,9 +567,10 @@ typename executor_t::policy_t::event_t _rot(
  * @param _incx Increment in X axis
  * @param _vx  VectorView
  * @param _incy Increment in Y axis
+ * @tparam accuracy How the products are accumulated
  */
-template <typename executor_t, typename container_0_t, typename container_1_t,
-          typename index_t, typename increment_t>
+template <Accuracy accuracy, typename executor_t, typename container_0_t,
+          typename container_1_t, typename index_t, typename increment_t>
 typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
@@ -312,8 +578,9 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
                                              increment_t _incy) {
   using element_t = typename ValueType<container_0_t>::type;
   auto res = std::vector<element_t>(1);
+  check_buffer_result<executor_t>();
   auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
-  blas::internal::_dot(ex, _N, _vx, _incx, _vy, _incy, gpu_res);
+  blas::internal::_dot<accuracy>(ex, _N, _vx, _incx, _vy, _incy, gpu_res);
   ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
   return res[0];
 }
@@ -329,6 +596,7 @@ index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
   using element_t = typename ValueType<container_t>::type;
   using IndValTuple = IndexValueTuple<element_t, index_t>;
   std::vector<IndValTuple> rsT(1, IndValTuple(index_t(-1), element_t(-1)));
+  check_buffer_result<executor_t>();
   auto gpu_res =
       make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
   blas::internal::_iamax(ex, _N, _vx, _incx, gpu_res);
@@ -347,6 +615,7 @@ index_t _iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
   using element_t = typename ValueType<container_t>::type;
   using IndValTuple = IndexValueTuple<element_t, index_t>;
   std::vector<IndValTuple> rsT(1, IndValTuple(index_t(-1), element_t(-1)));
+  check_buffer_result<executor_t>();
   auto gpu_res =
       make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
   blas::internal::_iamin(ex, _N, _vx, _incx, gpu_res);
@@ -360,16 +629,18 @@ index_t _iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
  * @param executor_t<ExecutorType> ex
  * @param _vx  VectorView
  * @param _incx Increment in X axis
+ * @tparam accuracy How the absolute values are accumulated
  */
-template <typename executor_t, typename container_t, typename index_t,
-          typename increment_t>
+template <Accuracy accuracy, typename executor_t, typename container_t,
+          typename index_t, typename increment_t>
 typename ValueType<container_t>::type _asum(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
   using element_t = typename ValueType<container_t>::type;
   auto res = std::vector<element_t>(1, element_t(0));
+  check_buffer_result<executor_t>();
   auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
-  blas::internal::_asum(ex, _N, _vx, _incx, gpu_res);
+  blas::internal::_asum<accuracy>(ex, _N, _vx, _incx, gpu_res);
   ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
   return res[0];
 }
@@ -388,12 +659,369 @@ typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
                                             increment_t _incx) {
   using element_t = typename ValueType<container_t>::type;
   auto res = std::vector<element_t>(1, element_t(0));
+  check_buffer_result<executor_t>();
   auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
   blas::internal::_nrm2(ex, _N, _vx, _incx, gpu_res);
   ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
   return res[0];
 }
 
+/**
+ * \brief Asynchronous DOT. The result stays on the device and the call does
+ * not block the host.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vx  VectorView
+ * @param _incy Increment in Y axis
+ * @return DeviceScalar holding the result and the events producing it
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+DeviceScalar<typename ValueType<container_0_t>::type,
+             typename executor_t::policy_t>
+_dot_async(executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+           container_1_t _vy, increment_t _incy) {
+  using element_t = typename ValueType<container_0_t>::type;
+  check_buffer_result<executor_t>();
+  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  auto ret = blas::internal::_dot(ex, _N, _vx, _incx, _vy, _incy, gpu_res);
+  return make_device_scalar(gpu_res, ret);
+}
+
+/**
+ * \brief Asynchronous IAMAX. The result stays on the device.
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<IndexValueTuple<typename ValueType<container_t>::type, index_t>,
+             typename executor_t::policy_t>
+_iamax_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  using IndValTuple = IndexValueTuple<element_t, index_t>;
+  check_buffer_result<executor_t>();
+  auto gpu_res =
+      make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
+  auto ret = blas::internal::_iamax(ex, _N, _vx, _incx, gpu_res);
+  return make_device_scalar(gpu_res, ret);
+}
+
+/**
+ * \brief Asynchronous IAMIN. The result stays on the device.
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<IndexValueTuple<typename ValueType<container_t>::type, index_t>,
+             typename executor_t::policy_t>
+_iamin_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  using IndValTuple = IndexValueTuple<element_t, index_t>;
+  check_buffer_result<executor_t>();
+  auto gpu_res =
+      make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
+  auto ret = blas::internal::_iamin(ex, _N, _vx, _incx, gpu_res);
+  return make_device_scalar(gpu_res, ret);
+}
+
+/**
+ * \brief Asynchronous ASUM. The result stays on the device.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<typename ValueType<container_t>::type,
+             typename executor_t::policy_t>
+_asum_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  check_buffer_result<executor_t>();
+  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  auto ret = blas::internal::_asum(ex, _N, _vx, _incx, gpu_res);
+  return make_device_scalar(gpu_res, ret);
+}
+
+/**
+ * \brief Asynchronous NRM2. The result stays on the device.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+DeviceScalar<typename ValueType<container_t>::type,
+             typename executor_t::policy_t>
+_nrm2_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  check_buffer_result<executor_t>();
+  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  auto ret = blas::internal::_nrm2(ex, _N, _vx, _incx, gpu_res);
+  return make_device_scalar(gpu_res, ret);
+}
+
+/**
+ * \brief Strided batched AXPY, y_b = alpha * x_b + y_b for every vector b of
+ * the batch. The batch is flattened so a single kernel updates every vector.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _stridey Distance between the first elements of two y vectors
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy_batched(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, index_t _stridex, container_1_t _vy, increment_t _incy,
+    index_t _stridey, index_t _batch_size) {
+  auto vx = make_batched_vector_view(ex, _vx, _N, _incx, _stridex, _batch_size);
+  auto vy = make_batched_vector_view(ex, _vy, _N, _incy, _stridey, _batch_size);
+
+  auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
+  auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
+  auto assignOp = make_op<Assign>(vy, addOp);
+  auto ret = ex.execute(assignOp);
+  return ret;
+}
+
+/**
+ * \brief Strided batched SCAL, x_b = alpha * x_b for every vector b of the
+ * batch, in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename element_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _scal_batched(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, index_t _stridex, index_t _batch_size) {
+  auto vx = make_batched_vector_view(ex, _vx, _N, _incx, _stridex, _batch_size);
+  auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
+  auto assignOp = make_op<Assign>(vx, scalOp);
+  auto ret = ex.execute(assignOp);
+  return ret;
+}
+
+/**
+ * \brief Reduces every vector of a batched tree into rs with one work group
+ * per vector. The work groups are no larger than needed to give each work
+ * item at least one element of the vector.
+ */
+template <typename operator_t, typename executor_t, typename lhs_t,
+          typename rhs_t, typename index_t>
+typename executor_t::policy_t::event_t _batched_reduction(executor_t &ex,
+                                                          lhs_t rs, rhs_t tree,
+                                                          index_t _N,
+                                                          index_t _batch_size) {
+  const size_t maxLocalSize = ex.get_policy_handler().get_work_group_size();
+  size_t localSize = 1;
+  while (2 * localSize <= maxLocalSize &&
+         localSize < static_cast<size_t>(_N)) {
+    localSize *= 2;
+  }
+  auto assignOp = make_batched_reduction<operator_t>(rs, tree, _N);
+  return ex.execute(assignOp, localSize,
+                    localSize * static_cast<size_t>(_batch_size), localSize);
+}
+
+/**
+ * \brief Strided batched DOT. Each vector pair is reduced by its own work
+ * group and its result written to _rs[b], in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _stridey Distance between the first elements of two y vectors
+ * @param _rs Output, one element per vector of the batch
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _vy, increment_t _incy, index_t _stridey,
+    container_2_t _rs, index_t _batch_size) {
+  auto vx = make_batched_vector_view(ex, _vx, _N, _incx, _stridex, _batch_size);
+  auto vy = make_batched_vector_view(ex, _vy, _N, _incy, _stridey, _batch_size);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1), _batch_size);
+  auto prdOp = make_op<BinaryOp, ProductOperator>(vx, vy);
+  auto ret = _batched_reduction<AddOperator>(ex, rs, prdOp, _N, _batch_size);
+  return ret;
+}
+
+/**
+ * \brief Strided batched NRM2. Each vector is reduced by its own work group
+ * and its norm written to _rs[b], in a single kernel.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _N Size of each vector
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between the first elements of two x vectors
+ * @param _rs Output, one element per vector of the batch
+ * @param _batch_size Number of vectors in the batch
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _nrm2_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _rs, index_t _batch_size) {
+  auto vx = make_batched_vector_view(ex, _vx, _N, _incx, _stridex, _batch_size);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1), _batch_size);
+  auto ssqOp = make_accumulator_op<ScaledSumSqOperator>(vx);
+  auto ret =
+      _batched_reduction<ScaledSumSqOperator>(ex, rs, ssqOp, _N, _batch_size);
+  return ret;
+}
+
+/**
+ * \brief AXPBY, y = alpha * x + beta * y, reading and writing each vector
+ * once.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _beta Scaling factor of y
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpby(executor_t &ex, index_t _N,
+                                              element_t _alpha,
+                                              container_0_t _vx,
+                                              increment_t _incx,
+                                              element_t _beta,
+                                              container_1_t _vy,
+                                              increment_t _incy) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto scalOpX = make_op<ScalarOp, ProductOperator>(_alpha, vx);
+  auto scalOpY = make_op<ScalarOp, ProductOperator>(_beta, vy);
+  auto addOp = make_op<BinaryOp, AddOperator>(scalOpX, scalOpY);
+  auto assignOp = make_op<Assign>(vy, addOp);
+  auto ret = _execute_chunked(ex, assignOp, _incx == 1 && _incy == 1);
+  return ret;
+}
+
+/**
+ * \brief WAXPBY, w = alpha * x + beta * y, in a single pass.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _beta Scaling factor of y
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _vw  VectorView
+ * @param _incw Increment in W axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _waxpby(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, element_t _beta, container_1_t _vy, increment_t _incy,
+    container_2_t _vw, increment_t _incw) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto vw = make_vector_view(ex, _vw, _incw, _N);
+  auto scalOpX = make_op<ScalarOp, ProductOperator>(_alpha, vx);
+  auto scalOpY = make_op<ScalarOp, ProductOperator>(_beta, vy);
+  auto addOp = make_op<BinaryOp, AddOperator>(scalOpX, scalOpY);
+  auto assignOp = make_op<Assign>(vw, addOp);
+  auto ret =
+      _execute_chunked(ex, assignOp, _incx == 1 && _incy == 1 && _incw == 1);
+  return ret;
+}
+
+/**
+ * \brief Fused AXPY and DOT, y = alpha * x + y and _rs = y . y, updating y
+ * while its squares are summed so y is only read and written once.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ * @param _rs Output, the squared norm of the updated y
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _axpy_dot(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    container_2_t _rs) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
+                             static_cast<index_t>(1));
+  auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
+  auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
+  auto assignOp = make_op<Assign>(vy, addOp);
+  // The first pass of the reduction evaluates every element exactly once, so
+  // y is updated there and the returned value squared
+  auto sqrOp = make_op<UnaryOp, SquareOperator>(assignOp);
+
+  const auto localSize = ex.get_policy_handler().get_work_group_size();
+  const auto nWG = 2 * localSize;
+  auto assignRedOp = make_AssignReduction<AddOperator>(rs, sqrOp, localSize,
+                                                       localSize * nWG);
+  auto ret = ex.execute(assignRedOp);
+  return ret;
+}
+
+/**
+ * \brief Fused SCAL and COPY, y = alpha * x, without modifying x.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha Scaling factor of x
+ * @param _vx  VectorView
+ * @param _incx Increment in X axis
+ * @param _vy  VectorView
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _scal_copy(executor_t &ex, index_t _N,
+                                                  element_t _alpha,
+                                                  container_0_t _vx,
+                                                  increment_t _incx,
+                                                  container_1_t _vy,
+                                                  increment_t _incy) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
+  auto assignOp = make_op<Assign>(vy, scalOp);
+  auto ret = _execute_chunked(ex, assignOp, _incx == 1 && _incy == 1);
+  return ret;
+}
+
 }  // namespace internal
 }  // namespace blas
 
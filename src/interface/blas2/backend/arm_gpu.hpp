@@ -0,0 +1,54 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename arm_gpu.hpp
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_BLAS2_ARM_GPU_BACKEND_HPP
+#define SYCL_BLAS_BLAS2_ARM_GPU_BACKEND_HPP
+
+namespace blas {
+namespace blas2 {
+namespace backend {
+/*!
+ * @brief Level 2 launch parameters for ARM Mali GPUs.
+ */
+struct Params {
+  // Work group size of the GEMV kernels
+  static constexpr int gemv_local_size = 128;
+  // Columns reduced by a work group when GEMV splits the columns
+  static constexpr int gemv_cols_per_wg = 1024;
+  // Work group size and local memory size of TRMV
+  static constexpr int trmv_local_size = 128;
+  // Edge of the square blocks of SYMV
+  static constexpr int symv_block_size = 16;
+  // Rows of a diagonal block of TRSV
+  static constexpr int trsv_local_size = 128;
+  // Work group size of GER, along the contiguous dimension of A
+  static constexpr int ger_local_size = 64;
+  // Rows of A updated by a GER work group, each row reusing one element of
+  // x staged in local memory
+  static constexpr int ger_tile_size = 16;
+};
+}  // namespace backend
+}  // namespace blas2
+}  // namespace blas
+#endif
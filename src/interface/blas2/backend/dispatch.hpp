@@ -0,0 +1,135 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename dispatch.hpp
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_BLAS2_BACKEND_DISPATCH_HPP
+#define SYCL_BLAS_BLAS2_BACKEND_DISPATCH_HPP
+#include "interface/blas2_interface.h"
+
+/*
+ * Level 2 dispatch shared by every device. The launch parameters are read
+ * from blas2::backend::Params, defined by the device header that
+ * backend.hpp includes before this file.
+ */
+namespace blas {
+namespace gemv {
+namespace backend {
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemv(
+    executor_t& ex, Transposition _trans, index_t _M, index_t _N,
+    element_t _alpha, container_0_t _a, index_t _lda, container_1_t _x,
+    increment_t _incx, element_t _beta, container_2_t _y, increment_t _incy) {
+  using params_t = blas::blas2::backend::Params;
+  const index_t localSize = index_t(params_t::gemv_local_size);
+  const index_t rows = _trans.is_normal() ? _M : _N;
+  const index_t cols = _trans.is_normal() ? _N : _M;
+  const index_t nCU =
+      static_cast<index_t>(ex.get_policy_handler().get_num_compute_units());
+  // The single-pass kernel gives a work item to each row when A is not
+  // transposed, and a work group to each row otherwise
+  const index_t singlePassWG =
+      _trans.is_normal() ? (rows - 1) / localSize + 1 : rows;
+  if (rows > 0 && singlePassWG < 4 * nCU && cols >= 4096) {
+    // Too few work groups to fill the device, the columns are split across
+    // work groups and reduced in a second kernel
+    const index_t nRowsWG = _trans.is_normal() ? localSize : index_t(1);
+    return blas::internal::_gemv_impl(
+        ex, _trans, _M, _N, _alpha, _a, _lda, _x, _incx, _beta, _y, _incy,
+        localSize, localSize, nRowsWG, index_t(params_t::gemv_cols_per_wg));
+  } else {
+    return blas::internal::_gemv_single_pass_impl(ex, _trans, _M, _N, _alpha,
+                                                  _a, _lda, _x, _incx, _beta,
+                                                  _y, _incy, localSize);
+  }
+}
+}  // namespace backend
+}  // namespace gemv
+
+namespace trmv {
+namespace backend {
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _trmv(
+    executor_t& ex, char _Uplo, Transposition _trans, char _Diag, index_t _N,
+    container_0_t _a, index_t _lda, container_1_t _x, increment_t _incx) {
+  using params_t = blas::blas2::backend::Params;
+  return blas::internal::_trmv_impl(ex, _Uplo, _trans, _Diag, _N, _a, _lda, _x,
+                                    _incx,
+                                    index_t(params_t::trmv_local_size),
+                                    index_t(params_t::trmv_local_size));
+}
+}  // namespace backend
+}  // namespace trmv
+
+namespace symv {
+namespace backend {
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _symv(
+    executor_t& ex, char _Uplo, index_t _N, element_t _alpha, container_0_t _a,
+    index_t _lda, container_1_t _x, increment_t _incx, element_t _beta,
+    container_2_t _y, increment_t _incy) {
+  using params_t = blas::blas2::backend::Params;
+  return blas::internal::_symv_blocked_impl(
+      ex, _Uplo, _N, _alpha, _a, _lda, _x, _incx, _beta, _y, _incy,
+      index_t(params_t::symv_block_size));
+}
+}  // namespace backend
+}  // namespace symv
+
+namespace trsv {
+namespace backend {
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _trsv(
+    executor_t& ex, char _Uplo, Transposition _trans, char _Diag, index_t _N,
+    container_0_t _a, index_t _lda, container_1_t _x, increment_t _incx) {
+  using params_t = blas::blas2::backend::Params;
+  return blas::internal::_trsv_impl(ex, _Uplo, _trans, _Diag, _N, _a, _lda, _x,
+                                    _incx,
+                                    index_t(params_t::trsv_local_size));
+}
+}  // namespace backend
+}  // namespace trsv
+
+namespace ger {
+namespace backend {
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _ger(
+    executor_t& ex, index_t _M, index_t _N, element_t _alpha, container_0_t _x,
+    increment_t _incx, container_1_t _y, increment_t _incy, container_2_t _a,
+    index_t _lda) {
+  using params_t = blas::blas2::backend::Params;
+  return blas::internal::_ger_impl(ex, _M, _N, _alpha, _x, _incx, _y, _incy, _a,
+                                   _lda, index_t(params_t::ger_local_size),
+                                   index_t(params_t::ger_tile_size));
+}
+}  // namespace backend
+}  // namespace ger
+}  // namespace blas
+#endif
@@ -117,6 +117,149 @@ typename Executor::policy_t::event_t _gemv_impl(
   return ret;
 }
 
+/*! _gemv_single_pass_impl.
+ * @brief Implementation of the General Matrix Vector product in a single
+ * kernel. Unlike _gemv_impl, no scratch matrix of partial sums is allocated
+ * and no second kernel is needed to reduce it and apply alpha and beta.
+ * Problems with too few rows to occupy the device with one work item per row
+ * are forwarded to _gemv_impl. The local size must be a power of two.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_single_pass_impl(
+    Executor& ex, Transposition _trans, index_t _M, index_t _N,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _vx,
+    increment_t _incx, element_t _beta, container_t2 _vy, increment_t _incy,
+    index_t _localSize = 0) {
+  Access accessOpr = Access(_trans);
+
+  index_t M = (_trans.is_normal()) ? _M : _N;
+  index_t N = (_trans.is_normal()) ? _N : _M;
+  if (M == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  auto mA = make_matrix_view(ex, _mA, M, N, _lda, accessOpr);
+  auto vx = make_vector_view(ex, _vx, _incx, N);
+  auto vy = make_vector_view(ex, _vy, _incy, M);
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  // The reduction inside a work group halves the active work items each step
+  if ((localSize & (localSize - 1)) != 0) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  // With row access a work group reduces each row, the rows being distributed
+  // over a few work groups per compute unit. Otherwise a work item reduces
+  // each row.
+  const index_t nCU =
+      static_cast<index_t>(ex.get_policy_handler().get_num_compute_units());
+  const index_t maxWG = 16 * nCU;
+  const index_t nWG = (mA.is_row_access()) ? std::min(M, maxWG)
+                                           : (M - 1) / localSize + 1;
+  // Short and wide problems with column access would leave most compute units
+  // idle, each active work item looping over every column. The columns are
+  // then split across work groups by the two-pass implementation instead.
+  if (!mA.is_row_access() && nWG < nCU && N > localSize) {
+    return _gemv_impl(ex, _trans, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta,
+                      _vy, _incy, localSize, localSize, localSize, localSize);
+  }
+  const index_t globalSize = localSize * nWG;
+
+  auto gemv = make_Gemv_Single_Pass(vy, mA, vx, _alpha, _beta, nWG);
+  return ex.execute(gemv, localSize, globalSize, localSize);
+}
+
+/*! _gemv_batched_impl.
+ * @brief Implementation of a batch of General Matrix Vector products, the
+ * problems being stored at a fixed stride from each other. All the batch is
+ * computed by one kernel, each work group taking one problem at a time.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_batched_impl(
+    Executor& ex, Transposition _trans, index_t _M, index_t _N,
+    element_t _alpha, container_t0 _mA, index_t _lda, index_t _strideA,
+    container_t1 _vx, increment_t _incx, index_t _stridex, element_t _beta,
+    container_t2 _vy, increment_t _incy, index_t _stridey,
+    index_t _batch_size, index_t _localSize = 0) {
+  Access accessOpr = Access(_trans);
+
+  index_t M = (_trans.is_normal()) ? _M : _N;
+  index_t N = (_trans.is_normal()) ? _N : _M;
+  if (M == 0 || _batch_size == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  auto mA = make_matrix_view(ex, _mA, M, N, _lda, accessOpr);
+  // The vector views span the whole batch, the kernel computes the position
+  // of each element from the strides and increments
+  const index_t sizeX =
+      (_batch_size - 1) * _stridex + (N - 1) * std::abs(_incx) + 1;
+  const index_t sizeY =
+      (_batch_size - 1) * _stridey + (M - 1) * std::abs(_incy) + 1;
+  auto vx = make_vector_view(ex, _vx, increment_t(1), sizeX);
+  auto vy = make_vector_view(ex, _vy, increment_t(1), sizeY);
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  const index_t maxWG = static_cast<index_t>(
+      16 * ex.get_policy_handler().get_num_compute_units());
+  const index_t nWG = std::min(_batch_size, maxWG);
+  const index_t globalSize = localSize * nWG;
+
+  auto gemv = make_Gemv_Batched(vy, mA, vx, _alpha, _beta, _incx, _incy,
+                                _strideA, _stridex, _stridey, _batch_size, nWG);
+  return ex.execute(gemv, localSize, globalSize, localSize);
+}
+
+/*! _gemv_multi_vector_impl.
+ * @brief Implementation of the General Matrix Vector product of one matrix
+ * with the columns of X. Up to 16 vectors are computed by each kernel, which
+ * reads A only once for all of them.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename container_t2>
+typename Executor::policy_t::event_t _gemv_multi_vector_impl(
+    Executor& ex, Transposition _trans, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _mX,
+    index_t _ldx, element_t _beta, container_t2 _mY, index_t _ldy,
+    index_t _localSize = 0) {
+  typename Executor::policy_t::event_t ret;
+  static constexpr int maxVectors = 16;
+  Access accessOpr = Access(_trans);
+
+  index_t M = (_trans.is_normal()) ? _M : _N;
+  index_t N = (_trans.is_normal()) ? _N : _M;
+  if (M == 0) {
+    return ret;
+  }
+
+  auto mA = make_matrix_view(ex, _mA, M, N, _lda, accessOpr);
+  auto mX = make_matrix_view(ex, _mX, N, _K, _ldx, Access::row_major());
+  auto mY = make_matrix_view(ex, _mY, M, _K, _ldy, Access::row_major());
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  const index_t nWG = (M - 1) / localSize + 1;
+  const index_t globalSize = localSize * nWG;
+
+  for (index_t first = 0; first < _K; first += maxVectors) {
+    const index_t num = std::min(index_t(maxVectors), _K - first);
+    auto gemv = make_Gemv_Multi_Vector<maxVectors>(mY, mA, mX, _alpha, _beta,
+                                                   first, num);
+    auto event =
+        ex.execute(gemv, localSize, globalSize, localSize * maxVectors);
+    ret.insert(ret.end(), event.begin(), event.end());
+  }
+  return ret;
+}
+
 /*! _TRMV.
  * @brief Implementation of the Triangular Matrix Vector product.
  */
@@ -221,9 +364,6 @@ typename Executor::policy_t::event_t _trmv_impl(
   return ret;
 }
 
-/*! _SYMV.
- * @brief Implementation of the Symmetric Matrix Vector product.
- */
 /*
 ssymv 	( 	character  	UPLO,
    integer  	N,
@@ -236,117 +376,94 @@ ssymv 	( 	character  	UPLO,
    real, dimension(*)  	Y,
    integer  	INCY
  ) 	*/
+/*! _symv_blocked_impl.
+ * @brief Implementation of the Symmetric Matrix Vector product reading each
+ * element of the stored triangle once. Every tile of the triangle adds both
+ * its direct and its transposed contribution to a scratch matrix of one
+ * column per block; a second kernel sums the columns and applies alpha and
+ * beta.
+ */
 template <typename Executor, typename index_t, typename element_t,
           typename container_t0, typename container_t1, typename increment_t,
           typename container_t2>
-typename Executor::policy_t::event_t _symv_impl(
+typename Executor::policy_t::event_t _symv_blocked_impl(
     Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mA,
     index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
-    container_t2 _vy, increment_t _incy, index_t _localSize = 0,
-    index_t _scratchPadSize = 0, index_t _nRowsWG = 0, index_t _nColsWG = 0) {
+    container_t2 _vy, increment_t _incy, index_t _tileSize = 0) {
   _Uplo = tolower(_Uplo);
 
   if ((_Uplo != 'u') && (_Uplo != 'l')) {
     throw std::invalid_argument("Erroneous parameter");
   }
-  Access accessOpr = Access::row_major();
-  int triangOpr = (_Uplo == 'u');
   index_t N = _N;
+  if (N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+  // The lower triangle is the upper triangle of the transposed view
+  Access accessOpr = (_Uplo == 'u') ? Access::row_major() : Access::col_major();
   auto mA = make_matrix_view(ex, _mA, N, N, _lda, accessOpr);
   auto vx = make_vector_view(ex, _vx, _incx, N);
   auto vy = make_vector_view(ex, _vy, _incy, N);
-  auto mAT = make_matrix_view(ex, _mA, N, N, _lda, Access::col_major());
 
-  const index_t interLoop = 1;
-
-  const index_t localSize = (_localSize == 0)
-                                ? ex.get_policy_handler().get_work_group_size()
-                                : _localSize;
-  const index_t scratchPadSize =
-      (_localSize == 0) ? localSize : _scratchPadSize;
-
-  const index_t nRowsWG_R = (_nRowsWG == 0) ? 1 : std::min(N, _nRowsWG);
-  const index_t nColsWG_R = (_nColsWG == 0) ? N : std::min(N, _nColsWG);
-
-  const index_t nWGPerRow_R = (N - 1) / nRowsWG_R + 1;
-  const index_t nWGPerCol_R = (N - 1) / nColsWG_R + 1;
-  const index_t globalSize_R = localSize * nWGPerRow_R * nWGPerCol_R;
-
-  const index_t nRowsWG_C = (_nRowsWG == 0) ? localSize : _nRowsWG;
-  const index_t nColsWG_C = (_nColsWG == 0) ? localSize : _nColsWG;
-
-  const index_t nWGPerRow_C = (N - 1) / nRowsWG_C + 1;
-  const index_t nWGPerCol_C = (N - 1) / nColsWG_C + 1;
-  const index_t globalSize_C = localSize * nWGPerRow_C * nWGPerCol_C;
+  // A work group per tile, one work item per row of the tile
+  const index_t wgSize =
+      static_cast<index_t>(ex.get_policy_handler().get_work_group_size());
+  const index_t tileSize =
+      (_tileSize == 0) ? std::min(index_t(32), wgSize) : _tileSize;
+  const index_t nBlocks = (N - 1) / tileSize + 1;
+  const index_t globalSize = tileSize * nBlocks * nBlocks;
+  const index_t scratchPadSize = tileSize * (tileSize + 1) + 2 * tileSize;
 
-  const index_t scratchSize_R =
-      ((scratchPadSize == 0) ? std::min(N, localSize) : 1) * nWGPerCol_R;
+  auto valT = blas::make_sycl_iterator_buffer<element_t>(N * nBlocks);
+  auto mat = make_matrix_view(ex, valT, N, nBlocks, nBlocks,
+                              Access::col_major());
 
-  auto valTR = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize_R);
-  auto matR = make_matrix_view(ex, valTR, N, scratchSize_R, scratchSize_R,
-                               Access::col_major());
-
-  const index_t scratchSize_C = nWGPerCol_C;
-
-  auto valTC = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize_C);
-  auto matC = make_matrix_view(ex, valTC, N, scratchSize_C, scratchSize_C,
-                               Access::col_major());
+  auto symv = make_Symv_Blocked(mat, mA, vx, nBlocks);
+  auto ret = ex.execute(symv, tileSize, globalSize, scratchPadSize);
 
-  if (mA.is_row_access()) {  // ROWS ACCESS
-    if (triangOpr == 1) {
-      auto gemvR = make_Gemv_Row<interLoop, false, true, true>(
-          matR, mA, vx, nWGPerRow_R, nWGPerCol_R, scratchPadSize);
-      auto gemvC = make_Gemv_Col<true, false, false>(
-          matC, mAT, vx, nWGPerRow_C, nWGPerCol_C, scratchPadSize);
-      ex.execute(gemvR, localSize, globalSize_R, scratchPadSize);
-      ex.execute(gemvC, localSize, globalSize_C, scratchPadSize);
-    } else {
-      auto gemvR = make_Gemv_Row<interLoop, true, true, false>(
-          matR, mA, vx, nWGPerRow_R, nWGPerCol_R, scratchPadSize);
-      auto gemvC = make_Gemv_Col<false, false, true>(
-          matC, mAT, vx, nWGPerRow_C, nWGPerCol_C, scratchPadSize);
-      ex.execute(gemvR, localSize, globalSize_R, scratchPadSize);
-      ex.execute(gemvC, localSize, globalSize_C, scratchPadSize);
-    }
-
-  } else {  // col major
-
-    if (triangOpr == 1) {
-      auto gemvC = make_Gemv_Col<false, true, true>(
-          matC, mA, vx, nWGPerRow_C, nWGPerCol_C, scratchPadSize);
-      auto gemvR = make_Gemv_Row<interLoop, true, false, false>(
-          matR, mAT, vx, nWGPerRow_R, nWGPerCol_R, scratchPadSize);
-      ex.execute(gemvC, localSize, globalSize_C, scratchPadSize);
-      ex.execute(gemvR, localSize, globalSize_R, scratchPadSize);
-    } else {
-      auto gemvC = make_Gemv_Col<true, true, false>(
-          matC, mA, vx, nWGPerRow_C, nWGPerCol_C, scratchPadSize);
-      auto gemvR = make_Gemv_Row<interLoop, false, false, true>(
-          matR, mAT, vx, nWGPerRow_R, nWGPerCol_R, scratchPadSize);
-      ex.execute(gemvC, localSize, globalSize_C, scratchPadSize);
-      ex.execute(gemvR, localSize, globalSize_R, scratchPadSize);
-    }
-  }
   auto scalOp1 = make_op<ScalarOp, ProductOperator>(_beta, vy);
-  auto addMOpR = make_addSetColumns(matR);
-  auto addMOpC = make_addSetColumns(matC);
-  auto addMOp = make_op<BinaryOp, AddOperator>(addMOpR, addMOpC);
+  auto addMOp = make_addSetColumns(mat);
   auto scalOp2 = make_op<ScalarOp, ProductOperator>(_alpha, addMOp);
   auto addOp = make_op<BinaryOp, AddOperator>(scalOp1, scalOp2);
   auto assignOp = make_op<Assign>(vy, addOp);
-  return ex.execute(assignOp, localSize);
+  auto event = ex.execute(assignOp);
+  ret.insert(ret.end(), event.begin(), event.end());
+  return ret;
 }
 
 /**** RANK 1 MODIFICATION ****/
 
+/*!
+ * @brief Launches a GerTiled tree over the whole matrix: the work groups
+ * cover localSize elements of the contiguous dimension and tileSize of the
+ * other one.
+ */
+template <bool Single, bool Lower, bool Upper, typename Executor,
+          typename index_t, typename element_t, typename matrix_t,
+          typename vector_1_t, typename vector_2_t>
+typename Executor::policy_t::event_t _ger_tiled_launch(
+    Executor& ex, matrix_t& mA, element_t _alpha, vector_1_t& vx,
+    vector_2_t& vy, index_t localSize, index_t tileSize) {
+  const index_t M = mA.get_size_row();
+  const index_t N = mA.get_size_col();
+  const index_t dimFast = (mA.is_row_access()) ? N : M;
+  const index_t dimSlow = (mA.is_row_access()) ? M : N;
+  const index_t nWG = ((dimFast - 1) / localSize + 1) *
+                      ((dimSlow - 1) / tileSize + 1);
+  const index_t scratchPadSize = (Single) ? tileSize : 2 * tileSize;
+
+  auto assignOp =
+      make_Ger_Tiled<Single, Lower, Upper>(mA, _alpha, vx, vy, tileSize);
+  return ex.execute(assignOp, localSize, localSize * nWG, scratchPadSize);
+}
+
 template <typename Executor, typename index_t, typename element_t,
           typename container_t0, typename increment_t, typename container_t1,
           typename container_t2>
 typename Executor::policy_t::event_t _ger_impl(
     Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _vx,
     increment_t _incx, container_t1 _vy, increment_t _incy, container_t2 _mA,
-    index_t _lda, index_t _localSize = 0, index_t _scratchPadSize = 0,
-    index_t _nRowsWG = 0, index_t _nColsWG = 0) {
+    index_t _lda, index_t _localSize = 0, index_t _tileSize = 0) {
   index_t M = _M;
   index_t N = _N;
   auto mA = make_matrix_view(ex, _mA, M, N, _lda, Access::row_major());
@@ -356,33 +473,10 @@ typename Executor::policy_t::event_t _ger_impl(
   const index_t localSize = (_localSize == 0)
                                 ? ex.get_policy_handler().get_work_group_size()
                                 : _localSize;
-  const index_t nRowsWG = (_nRowsWG == 0)
-                              ? ((mA.is_row_access()) ? 1 : localSize)
-                              : std::min(M, _nRowsWG);
-
-  const index_t nColsWG = (_nColsWG == 0)
-                              ? ((mA.is_row_access()) ? N : localSize)
-                              : std::min(N, _nColsWG);
-
-  const index_t scratchPadSize =
-      (_localSize == 0) ? localSize : _scratchPadSize;
-
-  const index_t nWGPerCol = (N - 1) / nColsWG + 1;
-  const index_t nWGPerRow = (M - 1) / nRowsWG + 1;
-  const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
+  const index_t tileSize = (_tileSize == 0) ? localSize : _tileSize;
 
-  typename Executor::policy_t::event_t ret;
-
-  if (mA.is_row_access()) {  // rowmajor
-    auto assignOp =
-        make_Ger_Row(mA, _alpha, vx, vy, nWGPerRow, nWGPerCol, scratchPadSize);
-    ret = ex.execute(assignOp, localSize, globalSize, scratchPadSize);
-  } else {  // colmajor
-    auto assignOp =
-        make_Ger_Col(mA, _alpha, vx, vy, nWGPerRow, nWGPerCol, scratchPadSize);
-    ret = ex.execute(assignOp, localSize, globalSize, scratchPadSize);
-  }
-  return ret;
+  return _ger_tiled_launch<true, true, true>(ex, mA, _alpha, vx, vy,
+                                             localSize, tileSize);
 }
 
 /*! _SYR.
@@ -403,7 +497,7 @@ template <typename Executor, typename index_t, typename element_t,
 typename Executor::policy_t::event_t _syr_impl(
     Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _vx,
     increment_t _incx, container_t1 _mA, index_t _lda, index_t _localSize = 0,
-    index_t _scratchPadSize = 0, index_t _nRowsWG = 0, index_t _nColsWG = 0) {
+    index_t _tileSize = 0) {
   _Uplo = tolower(_Uplo);
 
   int triangOpr = (_Uplo == 'u');
@@ -414,41 +508,14 @@ typename Executor::policy_t::event_t _syr_impl(
   const index_t localSize = (_localSize == 0)
                                 ? ex.get_policy_handler().get_work_group_size()
                                 : _localSize;
-  const index_t nRowsWG = (_nRowsWG == 0)
-                              ? ((mA.is_row_access()) ? 1 : localSize)
-                              : std::min(N, _nRowsWG);
-  const index_t nColsWG = (_nColsWG == 0)
-                              ? ((mA.is_row_access()) ? N : localSize)
-                              : std::min(N, _nColsWG);
-  const index_t scratchPadSize =
-      (_localSize == 0) ? localSize : _scratchPadSize;
-
-  const index_t nWGPerRow = (N - 1) / nRowsWG + 1;
-  const index_t nWGPerCol = (N - 1) / nColsWG + 1;
-  const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
+  const index_t tileSize = (_tileSize == 0) ? localSize : _tileSize;
 
-  if (mA.is_row_access()) {  // ROWS ACCESS
-    if (triangOpr) {
-      auto assignOp = make_Ger_Row<true, false, true, true>(
-          mA, _alpha, vx, vx, nWGPerRow, nWGPerCol, scratchPadSize);
-      return ex.execute(assignOp, localSize, globalSize, scratchPadSize);
-
-    } else {
-      auto assignOp = make_Ger_Row<true, true, true, false>(
-          mA, _alpha, vx, vx, nWGPerRow, nWGPerCol, scratchPadSize);
-      return ex.execute(assignOp, localSize, globalSize, scratchPadSize);
-    }
-
-  } else {  // COLUMN ACCESS
-    if (triangOpr) {
-      auto assignOp = make_Ger_Col<true, false, true, true>(
-          mA, _alpha, vx, vx, nWGPerRow, nWGPerCol, scratchPadSize);
-      return ex.execute(assignOp, localSize, globalSize, scratchPadSize);
-    } else {
-      auto assignOp = make_Ger_Col<true, true, true, false>(
-          mA, _alpha, vx, vx, nWGPerRow, nWGPerCol, scratchPadSize);
-      return ex.execute(assignOp, localSize, globalSize, scratchPadSize);
-    }
+  if (triangOpr) {
+    return _ger_tiled_launch<true, false, true>(ex, mA, _alpha, vx, vx,
+                                                localSize, tileSize);
+  } else {
+    return _ger_tiled_launch<true, true, false>(ex, mA, _alpha, vx, vx,
+                                                localSize, tileSize);
   }
 }
 
@@ -470,8 +537,7 @@ template <typename Executor, typename index_t, typename element_t,
 typename Executor::policy_t::event_t _syr2_impl(
     Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _vx,
     increment_t _incx, container_t1 _vy, increment_t _incy, container_t2 _mA,
-    index_t _lda, index_t _localSize = 0, index_t _scratchPadSize = 0,
-    index_t _nRowsWG = 0, index_t _nColsWG = 0) {
+    index_t _lda, index_t _localSize = 0, index_t _tileSize = 0) {
   _Uplo = tolower(_Uplo);
 
   int triangOpr = (_Uplo == 'u');
@@ -484,42 +550,369 @@ typename Executor::policy_t::event_t _syr2_impl(
   const index_t localSize = (_localSize == 0)
                                 ? ex.get_policy_handler().get_work_group_size()
                                 : _localSize;
-  const index_t nRowsWG = (_nRowsWG == 0)
-                              ? ((mA.is_row_access()) ? 1 : localSize)
-                              : std::min(N, _nRowsWG);
-  const index_t nColsWG = (_nColsWG == 0)
-                              ? ((mA.is_row_access()) ? N : localSize)
-                              : std::min(N, _nColsWG);
-  const index_t scratchPadSize =
-      (_localSize == 0) ? 2 * localSize : _scratchPadSize;
+  const index_t tileSize = (_tileSize == 0) ? localSize : _tileSize;
 
-  const index_t nWGPerRow = (N - 1) / nRowsWG + 1;
-  const index_t nWGPerCol = (N - 1) / nColsWG + 1;
-  const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
+  if (triangOpr) {
+    return _ger_tiled_launch<false, false, true>(ex, mA, _alpha, vx, vy,
+                                                 localSize, tileSize);
+  } else {
+    return _ger_tiled_launch<false, true, false>(ex, mA, _alpha, vx, vy,
+                                                 localSize, tileSize);
+  }
+}
 
-  if (mA.is_row_access()) {  // ROWS ACCESS
-    if (triangOpr) {
-      auto assignOp = make_Ger_Row<false, false, true, true>(
-          mA, _alpha, vx, vy, nWGPerRow, nWGPerCol, scratchPadSize);
-      return ex.execute(assignOp, localSize, globalSize, scratchPadSize);
+/*! _TRSV.
+ * @brief Implementation of the triangular solve op(A) * x = b, x holding b
+ * on entry. The system is solved by diagonal blocks of the work group size,
+ * each launch solving one block and updating the rows that depend on it, so
+ * that N / localSize launches are needed. The right-hand side is staged in a
+ * temporary vector so that the solved block stored in x is never read back
+ * by another work group of the same launch.
+ */
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t _trsv_impl(
+    Executor& ex, char _Uplo, Transposition _trans, char _Diag, index_t _N,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    index_t _localSize = 0) {
+  _Uplo = tolower(_Uplo);
+  _Diag = tolower(_Diag);
+  if (((_Uplo != 'u') && (_Uplo != 'l')) ||
+      ((_Diag != 'u') && (_Diag != 'n'))) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  typename Executor::policy_t::event_t ret;
+  if (_N == 0) {
+    return ret;
+  }
+
+  // op(A) is lower triangular when A is lower and not transposed, or upper
+  // and transposed
+  const bool lowerOpr = ((_Uplo == 'l') == _trans.is_normal());
+  const bool unitDiag = (_Diag == 'u');
+  auto mA = make_matrix_view(ex, _mA, _N, _N, _lda, Access(_trans));
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  using element_t = typename ValueType<container_t1>::type;
+  auto rhs = blas::make_sycl_iterator_buffer<element_t>(_N);
+  auto vrhs = make_vector_view(ex, rhs, increment_t(1), _N);
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  auto copyOp = make_op<Assign>(vrhs, vx);
+  ret = ex.execute(copyOp, localSize);
+  const index_t nBlocks = (_N - 1) / localSize + 1;
+
+  for (index_t b = 0; b < nBlocks; b++) {
+    // Forward substitution starts from the first block, backward substitution
+    // from the last one
+    const index_t blockBegin = ((lowerOpr) ? b : nBlocks - 1 - b) * localSize;
+    const index_t rest = (lowerOpr)
+                             ? _N - std::min(_N, blockBegin + localSize)
+                             : blockBegin;
+    const index_t nWG = std::max(index_t(1), (rest - 1) / localSize + 1);
+    const index_t globalSize = localSize * nWG;
+
+    typename Executor::policy_t::event_t event;
+    if (lowerOpr) {
+      if (unitDiag) {
+        auto trsv = make_Trsv_Block<true, true>(mA, vx, vrhs, blockBegin);
+        event = ex.execute(trsv, localSize, globalSize, localSize);
+      } else {
+        auto trsv = make_Trsv_Block<true, false>(mA, vx, vrhs, blockBegin);
+        event = ex.execute(trsv, localSize, globalSize, localSize);
+      }
+    } else {
+      if (unitDiag) {
+        auto trsv = make_Trsv_Block<false, true>(mA, vx, vrhs, blockBegin);
+        event = ex.execute(trsv, localSize, globalSize, localSize);
+      } else {
+        auto trsv = make_Trsv_Block<false, false>(mA, vx, vrhs, blockBegin);
+        event = ex.execute(trsv, localSize, globalSize, localSize);
+      }
+    }
+    ret.insert(ret.end(), event.begin(), event.end());
+  }
+  return ret;
+}
+
+/*! _GBMV.
+ * @brief Implementation of the banded matrix vector product. Only the
+ * (kl + ku + 1) x N band storage is read.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _gbmv_impl(
+    Executor& ex, Transposition _trans, index_t _M, index_t _N, index_t _KL,
+    index_t _KU, element_t _alpha, container_t0 _mA, index_t _lda,
+    container_t1 _vx, increment_t _incx, element_t _beta, container_t2 _vy,
+    increment_t _incy, index_t _localSize = 0) {
+  if (_lda < _KL + _KU + 1) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  index_t x_size = (_trans.is_normal()) ? _N : _M;
+  index_t y_size = (_trans.is_normal()) ? _M : _N;
+  if (y_size == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  auto mA =
+      make_matrix_view(ex, _mA, _KL + _KU + 1, _N, _lda, Access::row_major());
+  auto vx = make_vector_view(ex, _vx, _incx, x_size);
+  auto vy = make_vector_view(ex, _vy, _incy, y_size);
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  if (_trans.is_normal()) {
+    auto gbmv = make_Gbmv<false, false>(vy, mA, vx, _KL, _KU, _alpha, _beta);
+    return ex.execute(gbmv, localSize);
+  } else {
+    auto gbmv = make_Gbmv<true, false>(vy, mA, vx, _KL, _KU, _alpha, _beta);
+    return ex.execute(gbmv, localSize);
+  }
+}
+
+/*! _SBMV.
+ * @brief Implementation of the symmetric banded matrix vector product. Only
+ * the (k + 1) x N band storage of one triangle is read.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _sbmv_impl(
+    Executor& ex, char _Uplo, index_t _N, index_t _K, element_t _alpha,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    element_t _beta, container_t2 _vy, increment_t _incy,
+    index_t _localSize = 0) {
+  _Uplo = tolower(_Uplo);
+  if (((_Uplo != 'u') && (_Uplo != 'l')) || (_lda < _K + 1)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  auto mA = make_matrix_view(ex, _mA, _K + 1, _N, _lda, Access::row_major());
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  if (_Uplo == 'u') {
+    auto sbmv = make_Sbmv<true>(vy, mA, vx, _K, _alpha, _beta);
+    return ex.execute(sbmv, localSize);
+  } else {
+    auto sbmv = make_Sbmv<false>(vy, mA, vx, _K, _alpha, _beta);
+    return ex.execute(sbmv, localSize);
+  }
+}
+
+/*! _TBMV.
+ * @brief Implementation of the triangular banded matrix vector product. x is
+ * copied to a temporary buffer first, as every element of the result depends
+ * on several elements of x.
+ */
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t _tbmv_impl(
+    Executor& ex, char _Uplo, Transposition _trans, char _Diag, index_t _N,
+    index_t _K, container_t0 _mA, index_t _lda, container_t1 _vx,
+    increment_t _incx, index_t _localSize = 0) {
+  _Uplo = tolower(_Uplo);
+  _Diag = tolower(_Diag);
+  if (((_Uplo != 'u') && (_Uplo != 'l')) ||
+      ((_Diag != 'u') && (_Diag != 'n')) || (_lda < _K + 1)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  typename Executor::policy_t::event_t ret;
+  if (_N == 0) {
+    return ret;
+  }
+
+  using element_t = typename ValueType<container_t0>::type;
+  auto mA = make_matrix_view(ex, _mA, _K + 1, _N, _lda, Access::row_major());
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto tmp = blas::make_sycl_iterator_buffer<element_t>(_N);
+  auto vtmp = make_vector_view(ex, tmp, increment_t(1), _N);
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  auto copyOp = make_op<Assign>(vtmp, vx);
+  ret = ex.execute(copyOp, localSize);
+
+  // An upper triangular band is a general band with no sub-diagonal, a lower
+  // one a general band with no super-diagonal
+  const index_t kl = (_Uplo == 'u') ? 0 : _K;
+  const index_t ku = (_Uplo == 'u') ? _K : 0;
+  const element_t one = constant<element_t, const_val::one>::value();
+  const element_t zero = constant<element_t, const_val::zero>::value();
+  typename Executor::policy_t::event_t event;
+  if (_trans.is_normal()) {
+    if (_Diag == 'u') {
+      auto tbmv = make_Gbmv<false, true>(vx, mA, vtmp, kl, ku, one, zero);
+      event = ex.execute(tbmv, localSize);
     } else {
-      auto assignOp = make_Ger_Row<false, true, true, false>(
-          mA, _alpha, vx, vy, nWGPerRow, nWGPerCol, scratchPadSize);
-      return ex.execute(assignOp, localSize, globalSize, scratchPadSize);
+      auto tbmv = make_Gbmv<false, false>(vx, mA, vtmp, kl, ku, one, zero);
+      event = ex.execute(tbmv, localSize);
     }
-  } else {  // COLUMN ACCESS
-    if (triangOpr) {
-      auto assignOp = make_Ger_Col<false, false, true, true>(
-          mA, _alpha, vx, vy, nWGPerRow, nWGPerCol, scratchPadSize);
-      return ex.execute(assignOp, localSize, globalSize, scratchPadSize);
+  } else {
+    if (_Diag == 'u') {
+      auto tbmv = make_Gbmv<true, true>(vx, mA, vtmp, kl, ku, one, zero);
+      event = ex.execute(tbmv, localSize);
     } else {
-      auto assignOp = make_Ger_Col<false, true, true, false>(
-          mA, _alpha, vx, vy, nWGPerRow, nWGPerCol, scratchPadSize);
-      return ex.execute(assignOp, localSize, globalSize, scratchPadSize);
+      auto tbmv = make_Gbmv<true, false>(vx, mA, vtmp, kl, ku, one, zero);
+      event = ex.execute(tbmv, localSize);
     }
   }
+  ret.insert(ret.end(), event.begin(), event.end());
+  return ret;
+}
+
+/*! _SPMV.
+ * @brief Implementation of the packed symmetric matrix vector product. Only
+ * the N * (N + 1) / 2 packed elements are read.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _spmv_impl(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mAP,
+    container_t1 _vx, increment_t _incx, element_t _beta, container_t2 _vy,
+    increment_t _incy, index_t _localSize = 0) {
+  _Uplo = tolower(_Uplo);
+  if ((_Uplo != 'u') && (_Uplo != 'l')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  auto vAP = make_vector_view(ex, _mAP, increment_t(1), (_N * (_N + 1)) / 2);
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  if (_Uplo == 'u') {
+    auto spmv = make_Spmv<true>(vy, vAP, vx, _alpha, _beta);
+    return ex.execute(spmv, localSize);
+  } else {
+    auto spmv = make_Spmv<false>(vy, vAP, vx, _alpha, _beta);
+    return ex.execute(spmv, localSize);
+  }
 }
 
+/*! _TPMV.
+ * @brief Implementation of the packed triangular matrix vector product. x is
+ * copied to a temporary buffer first, as every element of the result depends
+ * on several elements of x.
+ */
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t _tpmv_impl(
+    Executor& ex, char _Uplo, Transposition _trans, char _Diag, index_t _N,
+    container_t0 _mAP, container_t1 _vx, increment_t _incx,
+    index_t _localSize = 0) {
+  _Uplo = tolower(_Uplo);
+  _Diag = tolower(_Diag);
+  if (((_Uplo != 'u') && (_Uplo != 'l')) ||
+      ((_Diag != 'u') && (_Diag != 'n'))) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  typename Executor::policy_t::event_t ret;
+  if (_N == 0) {
+    return ret;
+  }
+
+  using element_t = typename ValueType<container_t0>::type;
+  auto vAP = make_vector_view(ex, _mAP, increment_t(1), (_N * (_N + 1)) / 2);
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto tmp = blas::make_sycl_iterator_buffer<element_t>(_N);
+  auto vtmp = make_vector_view(ex, tmp, increment_t(1), _N);
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  auto copyOp = make_op<Assign>(vtmp, vx);
+  ret = ex.execute(copyOp, localSize);
+
+  const bool upper = (_Uplo == 'u');
+  const bool unit = (_Diag == 'u');
+  typename Executor::policy_t::event_t event;
+  if (_trans.is_normal()) {
+    if (upper) {
+      event = (unit) ? ex.execute(make_Tpmv<true, false, true>(vx, vAP, vtmp),
+                                  localSize)
+                     : ex.execute(make_Tpmv<true, false, false>(vx, vAP, vtmp),
+                                  localSize);
+    } else {
+      event = (unit) ? ex.execute(make_Tpmv<false, false, true>(vx, vAP, vtmp),
+                                  localSize)
+                     : ex.execute(make_Tpmv<false, false, false>(vx, vAP, vtmp),
+                                  localSize);
+    }
+  } else {
+    if (upper) {
+      event = (unit) ? ex.execute(make_Tpmv<true, true, true>(vx, vAP, vtmp),
+                                  localSize)
+                     : ex.execute(make_Tpmv<true, true, false>(vx, vAP, vtmp),
+                                  localSize);
+    } else {
+      event = (unit) ? ex.execute(make_Tpmv<false, true, true>(vx, vAP, vtmp),
+                                  localSize)
+                     : ex.execute(make_Tpmv<false, true, false>(vx, vAP, vtmp),
+                                  localSize);
+    }
+  }
+  ret.insert(ret.end(), event.begin(), event.end());
+  return ret;
+}
+
+/*! _SPR.
+ * @brief Implementation of the packed symmetric rank 1 update. A work item
+ * is launched per packed element, so only the stored triangle is updated.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename increment_t, typename container_t1>
+typename Executor::policy_t::event_t _spr_impl(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _vx,
+    increment_t _incx, container_t1 _mAP, index_t _localSize = 0) {
+  _Uplo = tolower(_Uplo);
+  if ((_Uplo != 'u') && (_Uplo != 'l')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vAP = make_vector_view(ex, _mAP, increment_t(1), (_N * (_N + 1)) / 2);
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  if (_Uplo == 'u') {
+    auto spr = make_Spr<true>(vAP, vx, _alpha);
+    return ex.execute(spr, localSize);
+  } else {
+    auto spr = make_Spr<false>(vAP, vx, _alpha);
+    return ex.execute(spr, localSize);
+  }
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#include "interface/blas2/backend/backend.hpp"
+
+namespace blas {
+namespace internal {
+
 /*!
  @brief Generalised matrix vector product with rectangular non-symmetric
  matrices.
@@ -555,8 +948,31 @@ typename Executor::policy_t::event_t inline _gemv(
     // finished, y is overwritten with the updated vector.
     increment_t _incy  // The increment for elements in y (nonzero).
 ) {
-  return _gemv_impl(ex, Transposition(_trans), _M, _N, _alpha, _mA, _lda, _vx,
-                    _incx, _beta, _vy, _incy);
+  return blas::gemv::backend::_gemv(ex, Transposition(_trans), _M, _N, _alpha,
+                                    _mA, _lda, _vx, _incx, _beta, _vy, _incy);
+}
+
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _gemv_batched(
+    Executor& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, index_t _strideA, container_t1 _vx,
+    increment_t _incx, index_t _stridex, element_t _beta, container_t2 _vy,
+    increment_t _incy, index_t _stridey, index_t _batch_size) {
+  return _gemv_batched_impl(ex, Transposition(_trans), _M, _N, _alpha, _mA,
+                            _lda, _strideA, _vx, _incx, _stridex, _beta, _vy,
+                            _incy, _stridey, _batch_size);
+}
+
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename container_t2>
+typename Executor::policy_t::event_t inline _gemv_multi_vector(
+    Executor& ex, char _trans, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _mX,
+    index_t _ldx, element_t _beta, container_t2 _mY, index_t _ldy) {
+  return _gemv_multi_vector_impl(ex, Transposition(_trans), _M, _N, _K, _alpha,
+                                 _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
 }
 
 template <typename Executor, typename index_t, typename container_t0,
@@ -564,10 +980,16 @@ template <typename Executor, typename index_t, typename container_t0,
 typename Executor::policy_t::event_t inline _trmv(
     Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N,
     container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx) {
-  // TODO: Here we can use some heuristics to select localn global, local, and
-  // scratch size per device
-  return _trmv_impl(ex, _Uplo, Transposition(_trans), _Diag, _N, _mA, _lda, _vx,
-                    _incx);
+  return blas::trmv::backend::_trmv(ex, _Uplo, Transposition(_trans), _Diag,
+                                    _N, _mA, _lda, _vx, _incx);
+}
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t inline _trsv(
+    Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx) {
+  return blas::trsv::backend::_trsv(ex, _Uplo, Transposition(_trans), _Diag,
+                                    _N, _mA, _lda, _vx, _incx);
 }
 template <typename Executor, typename index_t, typename element_t,
           typename container_t0, typename container_t1, typename increment_t,
@@ -576,10 +998,8 @@ typename Executor::policy_t::event_t inline _symv(
     Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mA,
     index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
     container_t2 _vy, increment_t _incy) {
-  // TODO: Here we can use some heuristics to select localn global, local, and
-  // scratch size per device
-  return _symv_impl(ex, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
-                    _incy);
+  return blas::symv::backend::_symv(ex, _Uplo, _N, _alpha, _mA, _lda, _vx,
+                                    _incx, _beta, _vy, _incy);
 }
 template <typename Executor, typename index_t, typename element_t,
           typename container_t0, typename increment_t, typename container_t1,
@@ -588,9 +1008,8 @@ typename Executor::policy_t::event_t inline _ger(
     Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _vx,
     increment_t _incx, container_t1 _vy, increment_t _incy, container_t2 _mA,
     index_t _lda) {
-  // TODO: Here we can use some heuristics to select localn global, local, and
-  // scratch size per device
-  return _ger_impl(ex, _M, _N, _alpha, _vx, _incx, _vy, _incy, _mA, _lda);
+  return blas::ger::backend::_ger(ex, _M, _N, _alpha, _vx, _incx, _vy, _incy,
+                                  _mA, _lda);
 }
 template <typename Executor, typename index_t, typename element_t,
           typename container_t0, typename increment_t, typename container_t1>
@@ -612,6 +1031,60 @@ typename Executor::policy_t::event_t inline _syr2(
   // scratch size per device
   return _syr2_impl(ex, _Uplo, _N, _alpha, _vx, _incx, _vy, _incy, _mA, _lda);
 }
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _gbmv(
+    Executor& ex, char _trans, index_t _M, index_t _N, index_t _KL,
+    index_t _KU, element_t _alpha, container_t0 _mA, index_t _lda,
+    container_t1 _vx, increment_t _incx, element_t _beta, container_t2 _vy,
+    increment_t _incy) {
+  return _gbmv_impl(ex, Transposition(_trans), _M, _N, _KL, _KU, _alpha, _mA,
+                    _lda, _vx, _incx, _beta, _vy, _incy);
+}
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _sbmv(
+    Executor& ex, char _Uplo, index_t _N, index_t _K, element_t _alpha,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    element_t _beta, container_t2 _vy, increment_t _incy) {
+  return _sbmv_impl(ex, _Uplo, _N, _K, _alpha, _mA, _lda, _vx, _incx, _beta,
+                    _vy, _incy);
+}
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t inline _tbmv(
+    Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N, index_t _K,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx) {
+  return _tbmv_impl(ex, _Uplo, Transposition(_trans), _Diag, _N, _K, _mA, _lda,
+                    _vx, _incx);
+}
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _spmv(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mAP,
+    container_t1 _vx, increment_t _incx, element_t _beta, container_t2 _vy,
+    increment_t _incy) {
+  return _spmv_impl(ex, _Uplo, _N, _alpha, _mAP, _vx, _incx, _beta, _vy,
+                    _incy);
+}
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t inline _tpmv(
+    Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_t0 _mAP, container_t1 _vx, increment_t _incx) {
+  return _tpmv_impl(ex, _Uplo, Transposition(_trans), _Diag, _N, _mAP, _vx,
+                    _incx);
+}
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename increment_t, typename container_t1>
+typename Executor::policy_t::event_t inline _spr(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _vx,
+    increment_t _incx, container_t1 _mAP) {
+  return _spr_impl(ex, _Uplo, _N, _alpha, _vx, _incx, _mAP);
+}
 
 }  // namespace internal
 }  // namespace blas
@@ -0,0 +1,159 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename deferred_interface.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_DEFERRED_INTERFACE_HPP
+#define SYCL_BLAS_DEFERRED_INTERFACE_HPP
+
+#include <memory>
+#include <vector>
+
+#include "blas_meta.h"
+#include "executors/executor.h"
+#include "interface/blas1_interface.hpp"
+#include "interface/deferred_interface.h"
+#include "operations/blas1_trees.h"
+#include "policy/sycl_policy_handler.h"
+#include "views/view.h"
+
+namespace blas {
+namespace internal {
+
+/*!
+ * @brief The calls deferred on an executor since the last flush, held in a
+ * single DeferredOp.
+ *
+ * Evaluating every call for element i before moving to element i + 1 gives
+ * the result of running the calls one after the other only if element i of
+ * a call depends on element i of the previous calls alone. This holds when
+ * the calls have the same size and each buffer is always walked from the
+ * same offset with the same increment, since different buffers never
+ * overlap. A call breaking it starts a new chain.
+ */
+template <typename element_t, typename index_t, typename increment_t>
+class DeferredChain : public PolicyHandler<codeplay_policy>::DeferredCalls {
+ public:
+  using policy_handler_t = PolicyHandler<codeplay_policy>;
+  using container_t = BufferIterator<element_t, codeplay_policy>;
+  using view_t = typename VectorViewTypeFactory<codeplay_policy, container_t,
+                                                index_t, increment_t>::output_t;
+  // Calls fused in a single kernel at most
+  static constexpr int max_calls = 8;
+
+  /*!
+   * @param vy a view of the first call, bound by the unused slots
+   */
+  DeferredChain(index_t _N, view_t &vy)
+      : size_(_N), calls_(0), unit_stride_(true), tree_(vy) {}
+
+  /*!
+   * @brief Adds the call y = alpha * x (+ y when _accumulate) to the chain,
+   * unless it cannot be fused with the calls already in it.
+   * @return whether the call was added
+   */
+  bool add(Executor<policy_handler_t> &ex, index_t _N, element_t _alpha,
+           container_t _vx, increment_t _incx, container_t _vy,
+           increment_t _incy, bool _accumulate) {
+    if (calls_ == max_calls || _N != size_ || conflicts(_vx, _incx) ||
+        conflicts(_vy, _incy)) {
+      return false;
+    }
+    accesses_.push_back({_vx.get_buffer(), _vx.get_offset(), _incx});
+    accesses_.push_back({_vy.get_buffer(), _vy.get_offset(), _incy});
+    unit_stride_ = unit_stride_ && _incx == 1 && _incy == 1;
+    auto vx = make_vector_view(ex, _vx, _incx, _N);
+    auto vy = make_vector_view(ex, _vy, _incy, _N);
+    tree_.set(calls_++, vx, vy, _alpha, _accumulate);
+    return true;
+  }
+
+  /*!
+   * @brief Submits the calls as a single kernel. The chain does not keep an
+   * executor, which would keep the handler holding the chain alive.
+   */
+  typename codeplay_policy::event_t flush(
+      const policy_handler_t &policy_handler) override {
+    Executor<policy_handler_t> ex(policy_handler);
+    return _execute_chunked(ex, tree_, unit_stride_);
+  }
+
+ private:
+  struct Access {
+    typename container_t::buff_t buffer;
+    std::ptrdiff_t offset;
+    increment_t increment;
+  };
+
+  // Whether the chain walks the buffer of _vx differently
+  bool conflicts(container_t _vx, increment_t _incx) const {
+    for (const auto &access : accesses_) {
+      if (access.buffer == _vx.get_buffer() &&
+          (access.offset != _vx.get_offset() || access.increment != _incx)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  index_t size_;
+  int calls_;
+  // Whether every view of the chain is contiguous, for vector accesses
+  bool unit_stride_;
+  DeferredOp<view_t, max_calls> tree_;
+  std::vector<Access> accesses_;
+};
+
+template <typename element_t, typename index_t, typename increment_t>
+inline bool _defer(Executor<PolicyHandler<codeplay_policy>> &ex, index_t _N,
+                   element_t _alpha,
+                   BufferIterator<element_t, codeplay_policy> _vx,
+                   increment_t _incx,
+                   BufferIterator<element_t, codeplay_policy> _vy,
+                   increment_t _incy, bool _accumulate) {
+  using chain_t = DeferredChain<element_t, index_t, increment_t>;
+  using calls_t =
+      std::shared_ptr<PolicyHandler<codeplay_policy>::DeferredCalls>;
+  if (_N <= 0) {
+    return false;
+  }
+  auto policy_handler = ex.get_policy_handler();
+  return policy_handler.update_deferred_calls([&](calls_t &calls) {
+    auto chain = std::dynamic_pointer_cast<chain_t>(calls);
+    if (chain &&
+        chain->add(ex, _N, _alpha, _vx, _incx, _vy, _incy, _accumulate)) {
+      return;
+    }
+    // The calls this one cannot be fused with run first
+    policy_handler.flush_deferred();
+    auto vy = make_vector_view(ex, _vy, _incy, _N);
+    chain = std::make_shared<chain_t>(_N, vy);
+    chain->add(ex, _N, _alpha, _vx, _incx, _vy, _incy, _accumulate);
+    calls = chain;
+  });
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // SYCL_BLAS_DEFERRED_INTERFACE_HPP
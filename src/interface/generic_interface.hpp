@@ -0,0 +1,94 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename generic_interface.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_GENERIC_INTERFACE_HPP
+#define SYCL_BLAS_GENERIC_INTERFACE_HPP
+
+#include "blas_meta.h"
+#include "container/device_scalar.h"
+#include "container/sycl_iterator.h"
+#include "executors/executor.h"
+#include "interface/generic_interface.h"
+#include "operations/blas1_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view.h"
+
+namespace blas {
+
+template <typename executor_t, typename view_t, typename functor_t>
+DeviceScalar<typename view_t::value_t, typename executor_t::policy_t> _reduce(
+    executor_t &ex, view_t _vx, functor_t, typename view_t::value_t _init) {
+  using element_t = typename view_t::value_t;
+  using index_t = typename view_t::index_t;
+  using operator_t = UserReduceOperator<functor_t>;
+  static_assert(
+      std::is_same<typename executor_t::policy_t, codeplay_policy>::value,
+      "_reduce keeps its result in a buffer and requires codeplay_policy.");
+  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  auto rs = make_vector_view(ex, gpu_res, static_cast<index_t>(1),
+                             static_cast<index_t>(1));
+
+  const auto localSize = ex.get_policy_handler().get_work_group_size();
+  const auto nWG = 2 * localSize;
+  auto assignOp =
+      make_AssignReduction<operator_t>(rs, _vx, localSize, localSize * nWG);
+  auto ret = ex.execute(assignOp);
+
+  // The reduction starts from the identity, _init is combined at the end
+  auto initOp = make_op<ScalarOp, operator_t>(_init, rs);
+  auto assignInitOp = make_op<Assign>(rs, initOp);
+  auto initEvent = ex.execute(assignInitOp);
+  ret.insert(ret.end(), initEvent.begin(), initEvent.end());
+  return make_device_scalar(gpu_res, ret);
+}
+
+template <typename executor_t, typename in_view_t, typename out_view_t,
+          typename functor_t>
+typename executor_t::policy_t::event_t _transform(executor_t &ex,
+                                                  in_view_t _vx,
+                                                  out_view_t _vout,
+                                                  functor_t _op) {
+  auto functorOp = make_functor_op(_op, _vx);
+  auto assignOp = make_op<Assign>(_vout, functorOp);
+  auto ret = ex.execute(assignOp);
+  return ret;
+}
+
+template <typename executor_t, typename in_view_0_t, typename in_view_1_t,
+          typename out_view_t, typename functor_t>
+typename executor_t::policy_t::event_t _transform(executor_t &ex,
+                                                  in_view_0_t _vx,
+                                                  in_view_1_t _vy,
+                                                  out_view_t _vout,
+                                                  functor_t _op) {
+  auto functorOp = make_functor_op(_op, _vx, _vy);
+  auto assignOp = make_op<Assign>(_vout, functorOp);
+  auto ret = ex.execute(assignOp);
+  return ret;
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_GENERIC_INTERFACE_HPP
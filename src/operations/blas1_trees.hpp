@@ -46,6 +46,7 @@ struct DetectScalar {
   static typename element_t::value_t get_scalar(element_t &opSCL) {
     return opSCL.eval(0);
   }
+  static void bind(element_t &opSCL, cl::sycl::handler &h) { opSCL.bind(h); }
 };
 
 /*! DetectScalar.
@@ -55,6 +56,7 @@ template <>
 struct DetectScalar<int> {
   using element_t = int;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
 };
 
 /*! DetectScalar.
@@ -64,6 +66,7 @@ template <>
 struct DetectScalar<float> {
   using element_t = float;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
 };
 
 /*! DetectScalar.
@@ -73,6 +76,7 @@ template <>
 struct DetectScalar<double> {
   using element_t = double;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
 };
 
 /*! DetectScalar.
@@ -82,6 +86,7 @@ template <>
 struct DetectScalar<std::complex<float>> {
   using element_t = std::complex<float>;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
 };
 
 /*! DetectScalar.
@@ -91,6 +96,7 @@ template <>
 struct DetectScalar<std::complex<double>> {
   using element_t = std::complex<double>;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
 };
 
 /*! get_scalar.
@@ -101,6 +107,86 @@ auto get_scalar(element_t &scalar_)
     -> decltype(DetectScalar<element_t>::get_scalar(scalar_)) {
   return DetectScalar<element_t>::get_scalar(scalar_);
 }
+
+/*! bind_scalar.
+ * @brief Template autodecuction function for DetectScalar, binding the
+ * scalar to the command group when it is read from device memory.
+ */
+template <typename element_t>
+void bind_scalar(element_t &scalar_, cl::sycl::handler &h) {
+  DetectScalar<element_t>::bind(scalar_, h);
+}
+
+/*! ReductionFinaliser.
+ * @brief Converts the accumulated value of a reduction to the value type of
+ * its output. Partial results written to scratch keep the accumulator type
+ * and are left untouched; only the final write calls operator_t::finalise.
+ */
+template <typename operator_t, typename out_t, typename acc_t>
+struct ReductionFinaliser {
+  static SYCL_BLAS_INLINE out_t eval(const acc_t &val) {
+    return operator_t::template finalise<out_t>(val);
+  }
+};
+
+/*! ReductionFinaliser.
+ * @brief See ReductionFinaliser.
+ */
+template <typename operator_t, typename out_t>
+struct ReductionFinaliser<operator_t, out_t, out_t> {
+  static SYCL_BLAS_INLINE out_t eval(const out_t &val) { return val; }
+};
+/*! ChunkEvaluator.
+ * @brief Evaluates the chunks of a ChunkedOp. Non-specialised case for views
+ * of any stride: each work item evaluates chunk_size elements that are a grid
+ * apart, so neighbouring work items keep accessing neighbouring elements.
+ */
+template <bool vectorised>
+struct ChunkEvaluator {
+  template <int chunk_size, typename tree_t>
+  static SYCL_BLAS_INLINE void eval(tree_t &tree,
+                                    cl::sycl::nd_item<1> ndItem) {
+    using index_t = typename tree_t::index_t;
+    const index_t size = tree.get_size();
+    const index_t grid = ndItem.get_global_range(0);
+    for (index_t i = ndItem.get_global_id(0); i < size;
+         i += chunk_size * grid) {
+#pragma unroll
+      for (int j = 0; j < chunk_size; j++) {
+        const index_t k = i + j * grid;
+        if (k < size) {
+          tree.eval(k);
+        }
+      }
+    }
+  }
+};
+
+/*! ChunkEvaluator.
+ * @brief Specialised case for unit stride views: each work item evaluates
+ * chunk_size consecutive elements with vector loads and stores. The elements
+ * after the last full chunk are evaluated one by one.
+ */
+template <>
+struct ChunkEvaluator<true> {
+  template <int chunk_size, typename tree_t>
+  static SYCL_BLAS_INLINE void eval(tree_t &tree,
+                                    cl::sycl::nd_item<1> ndItem) {
+    using index_t = typename tree_t::index_t;
+    const index_t size = tree.get_size();
+    const index_t grid = ndItem.get_global_range(0);
+    const index_t full_chunks_end = size - (size % chunk_size);
+    for (index_t i = ndItem.get_global_id(0) * chunk_size; i < full_chunks_end;
+         i += chunk_size * grid) {
+      tree.template eval_vec<chunk_size>(i);
+    }
+    const index_t tail = full_chunks_end + ndItem.get_global_id(0);
+    if (tail < size) {
+      tree.eval(tail);
+    }
+  }
+};
+
 }  // namespace internal
 
 /** Join.
@@ -170,6 +256,13 @@ Assign<lhs_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
   return Assign<lhs_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 
+template <typename lhs_t, typename rhs_t>
+template <int width>
+SYCL_BLAS_INLINE void Assign<lhs_t, rhs_t>::eval_vec(
+    typename Assign<lhs_t, rhs_t>::index_t i) {
+  lhs_.template store_vec<width>(i, rhs_.template eval_vec<width>(i));
+}
+
 template <typename lhs_t, typename rhs_t>
 SYCL_BLAS_INLINE void Assign<lhs_t, rhs_t>::bind(cl::sycl::handler &h) {
   lhs_.bind(h);
@@ -263,8 +356,18 @@ ScalarOp<operator_t, scalar_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
   return ScalarOp<operator_t, scalar_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 template <typename operator_t, typename scalar_t, typename rhs_t>
+template <int width>
+SYCL_BLAS_INLINE cl::sycl::vec<
+    typename ScalarOp<operator_t, scalar_t, rhs_t>::value_t, width>
+ScalarOp<operator_t, scalar_t, rhs_t>::eval_vec(
+    typename ScalarOp<operator_t, scalar_t, rhs_t>::index_t i) {
+  return operator_t::eval(internal::get_scalar(scalar_),
+                          rhs_.template eval_vec<width>(i));
+}
+template <typename operator_t, typename scalar_t, typename rhs_t>
 SYCL_BLAS_INLINE void ScalarOp<operator_t, scalar_t, rhs_t>::bind(
     cl::sycl::handler &h) {
+  internal::bind_scalar(scalar_, h);
   rhs_.bind(h);
 }
 
@@ -333,12 +436,418 @@ BinaryOp<operator_t, lhs_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
   return BinaryOp<operator_t, lhs_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 template <typename operator_t, typename lhs_t, typename rhs_t>
+template <int width>
+SYCL_BLAS_INLINE cl::sycl::vec<
+    typename BinaryOp<operator_t, lhs_t, rhs_t>::value_t, width>
+BinaryOp<operator_t, lhs_t, rhs_t>::eval_vec(
+    typename BinaryOp<operator_t, lhs_t, rhs_t>::index_t i) {
+  return operator_t::eval(lhs_.template eval_vec<width>(i),
+                          rhs_.template eval_vec<width>(i));
+}
+template <typename operator_t, typename lhs_t, typename rhs_t>
 SYCL_BLAS_INLINE void BinaryOp<operator_t, lhs_t, rhs_t>::bind(
     cl::sycl::handler &h) {
   lhs_.bind(h);
   rhs_.bind(h);
 }
 
+/*! FunctorOp.
+ * @brief Applies a user functor to every element of a tree.
+ */
+template <typename functor_t, typename rhs_t>
+FunctorOp<functor_t, rhs_t>::FunctorOp(functor_t _functor, rhs_t &_r)
+    : functor_(_functor), rhs_(_r) {}
+
+template <typename functor_t, typename rhs_t>
+SYCL_BLAS_INLINE typename FunctorOp<functor_t, rhs_t>::index_t
+FunctorOp<functor_t, rhs_t>::get_size() const {
+  return rhs_.get_size();
+}
+
+template <typename functor_t, typename rhs_t>
+SYCL_BLAS_INLINE bool FunctorOp<functor_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) < FunctorOp<functor_t, rhs_t>::get_size()));
+}
+
+template <typename functor_t, typename rhs_t>
+SYCL_BLAS_INLINE typename FunctorOp<functor_t, rhs_t>::value_t
+FunctorOp<functor_t, rhs_t>::eval(
+    typename FunctorOp<functor_t, rhs_t>::index_t i) {
+  return functor_(rhs_.eval(i));
+}
+
+template <typename functor_t, typename rhs_t>
+SYCL_BLAS_INLINE typename FunctorOp<functor_t, rhs_t>::value_t
+FunctorOp<functor_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return FunctorOp<functor_t, rhs_t>::eval(ndItem.get_global_id(0));
+}
+
+template <typename functor_t, typename rhs_t>
+SYCL_BLAS_INLINE void FunctorOp<functor_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  rhs_.bind(h);
+}
+
+/*! BinaryFunctorOp.
+ * @brief Applies a user functor to the elements of two trees.
+ */
+template <typename functor_t, typename lhs_t, typename rhs_t>
+BinaryFunctorOp<functor_t, lhs_t, rhs_t>::BinaryFunctorOp(functor_t _functor,
+                                                          lhs_t &_l, rhs_t &_r)
+    : functor_(_functor), lhs_(_l), rhs_(_r) {}
+
+template <typename functor_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename BinaryFunctorOp<functor_t, lhs_t, rhs_t>::index_t
+BinaryFunctorOp<functor_t, lhs_t, rhs_t>::get_size() const {
+  return rhs_.get_size();
+}
+
+template <typename functor_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE bool BinaryFunctorOp<functor_t, lhs_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) <
+           BinaryFunctorOp<functor_t, lhs_t, rhs_t>::get_size()));
+}
+
+template <typename functor_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename BinaryFunctorOp<functor_t, lhs_t, rhs_t>::value_t
+BinaryFunctorOp<functor_t, lhs_t, rhs_t>::eval(
+    typename BinaryFunctorOp<functor_t, lhs_t, rhs_t>::index_t i) {
+  return functor_(lhs_.eval(i), rhs_.eval(i));
+}
+
+template <typename functor_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename BinaryFunctorOp<functor_t, lhs_t, rhs_t>::value_t
+BinaryFunctorOp<functor_t, lhs_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return BinaryFunctorOp<functor_t, lhs_t, rhs_t>::eval(
+      ndItem.get_global_id(0));
+}
+
+template <typename functor_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE void BinaryFunctorOp<functor_t, lhs_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+}
+
+/*! RotmOp.
+ * @brief Evaluates one row of the modified Givens transformation.
+ */
+template <int row, typename param_t, typename lhs_t, typename rhs_t>
+RotmOp<row, param_t, lhs_t, rhs_t>::RotmOp(param_t &_param, lhs_t &_l,
+                                           rhs_t &_r)
+    : param_(_param), lhs_(_l), rhs_(_r) {}
+
+template <int row, typename param_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename RotmOp<row, param_t, lhs_t, rhs_t>::index_t
+RotmOp<row, param_t, lhs_t, rhs_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <int row, typename param_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE bool RotmOp<row, param_t, lhs_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) <
+           RotmOp<row, param_t, lhs_t, rhs_t>::get_size()));
+}
+
+template <int row, typename param_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename RotmOp<row, param_t, lhs_t, rhs_t>::value_t
+RotmOp<row, param_t, lhs_t, rhs_t>::eval(
+    typename RotmOp<row, param_t, lhs_t, rhs_t>::index_t i) {
+  const value_t one = constant<value_t, const_val::one>::value();
+  const value_t flag = param_.eval(0);
+  const value_t x = lhs_.eval(i);
+  const value_t y = rhs_.eval(i);
+  // flag -2 is the identity, the other flags give the implicit entries of H
+  if (flag < value_t(-1.5)) {
+    return (row == 0) ? x : y;
+  }
+  value_t h_x;
+  value_t h_y;
+  if (flag < value_t(-0.5)) {
+    h_x = param_.eval(row == 0 ? 1 : 2);
+    h_y = param_.eval(row == 0 ? 3 : 4);
+  } else if (flag < value_t(0.5)) {
+    h_x = (row == 0) ? one : param_.eval(2);
+    h_y = (row == 0) ? param_.eval(3) : one;
+  } else {
+    h_x = (row == 0) ? param_.eval(1) : -one;
+    h_y = (row == 0) ? one : param_.eval(4);
+  }
+  return h_x * x + h_y * y;
+}
+
+template <int row, typename param_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename RotmOp<row, param_t, lhs_t, rhs_t>::value_t
+RotmOp<row, param_t, lhs_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return RotmOp<row, param_t, lhs_t, rhs_t>::eval(ndItem.get_global_id(0));
+}
+
+template <int row, typename param_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE void RotmOp<row, param_t, lhs_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  param_.bind(h);
+  lhs_.bind(h);
+  rhs_.bind(h);
+}
+
+/*! Rotmg.
+ * @brief Constructs the modified Givens transformation on the device.
+ */
+template <typename d1_t, typename d2_t, typename x1_t, typename y1_t,
+          typename param_t>
+Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::Rotmg(d1_t &_d1, d2_t &_d2, x1_t &_x1,
+                                              y1_t &_y1, param_t &_param)
+    : d1_(_d1), d2_(_d2), x1_(_x1), y1_(_y1), param_(_param) {}
+
+template <typename d1_t, typename d2_t, typename x1_t, typename y1_t,
+          typename param_t>
+SYCL_BLAS_INLINE typename Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::index_t
+Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::get_size() const {
+  return 1;
+}
+
+template <typename d1_t, typename d2_t, typename x1_t, typename y1_t,
+          typename param_t>
+SYCL_BLAS_INLINE bool Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return (ndItem.get_global_id(0) == 0);
+}
+
+template <typename d1_t, typename d2_t, typename x1_t, typename y1_t,
+          typename param_t>
+SYCL_BLAS_INLINE typename Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::value_t
+Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::eval(
+    typename Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::index_t) {
+  // Same algorithm and rescaling constants as the reference BLAS
+  const value_t zero = constant<value_t, const_val::zero>::value();
+  const value_t one = constant<value_t, const_val::one>::value();
+  const value_t gam = value_t(4096);
+  const value_t gamsq = gam * gam;
+  const value_t rgamsq = one / gamsq;
+
+  value_t d1 = d1_.eval(0);
+  value_t d2 = d2_.eval(0);
+  value_t x1 = x1_.eval(0);
+  const value_t y1 = y1_.eval(0);
+  value_t flag;
+  value_t h11 = zero;
+  value_t h12 = zero;
+  value_t h21 = zero;
+  value_t h22 = zero;
+
+  if (d1 < zero) {
+    flag = -one;
+    d1 = d2 = x1 = zero;
+  } else {
+    const value_t p2 = d2 * y1;
+    if (p2 == zero) {
+      param_.eval(0) = value_t(-2);
+      return param_.eval(0);
+    }
+    const value_t p1 = d1 * x1;
+    const value_t q2 = p2 * y1;
+    const value_t q1 = p1 * x1;
+    const value_t abs_q1 = (q1 < zero) ? -q1 : q1;
+    const value_t abs_q2 = (q2 < zero) ? -q2 : q2;
+    if (abs_q1 > abs_q2) {
+      h21 = -y1 / x1;
+      h12 = p2 / p1;
+      const value_t u = one - h12 * h21;
+      if (u > zero) {
+        flag = zero;
+        d1 /= u;
+        d2 /= u;
+        x1 *= u;
+      } else {
+        flag = -one;
+        h11 = h12 = h21 = h22 = zero;
+        d1 = d2 = x1 = zero;
+      }
+    } else if (q2 < zero) {
+      flag = -one;
+      h11 = h12 = h21 = h22 = zero;
+      d1 = d2 = x1 = zero;
+    } else {
+      flag = one;
+      h11 = p1 / p2;
+      h22 = x1 / y1;
+      const value_t u = one + h11 * h22;
+      const value_t temp = d2 / u;
+      d2 = d1 / u;
+      d1 = temp;
+      x1 = y1 * u;
+    }
+    // Rescale d1 and d2 into [rgamsq, gamsq], which makes H a full matrix
+    if (d1 != zero) {
+      while ((d1 <= rgamsq) || (d1 >= gamsq)) {
+        if (flag == zero) {
+          h11 = h22 = one;
+        } else {
+          h21 = -one;
+          h12 = one;
+        }
+        flag = -one;
+        if (d1 <= rgamsq) {
+          d1 *= gamsq;
+          x1 /= gam;
+          h11 /= gam;
+          h12 /= gam;
+        } else {
+          d1 /= gamsq;
+          x1 *= gam;
+          h11 *= gam;
+          h12 *= gam;
+        }
+      }
+    }
+    if (d2 != zero) {
+      value_t abs_d2 = (d2 < zero) ? -d2 : d2;
+      while ((abs_d2 <= rgamsq) || (abs_d2 >= gamsq)) {
+        if (flag == zero) {
+          h11 = h22 = one;
+        } else {
+          h21 = -one;
+          h12 = one;
+        }
+        flag = -one;
+        if (abs_d2 <= rgamsq) {
+          d2 *= gamsq;
+          h21 /= gam;
+          h22 /= gam;
+        } else {
+          d2 /= gamsq;
+          h21 *= gam;
+          h22 *= gam;
+        }
+        abs_d2 = (d2 < zero) ? -d2 : d2;
+      }
+    }
+  }
+
+  if (flag < zero) {
+    param_.eval(1) = h11;
+    param_.eval(2) = h21;
+    param_.eval(3) = h12;
+    param_.eval(4) = h22;
+  } else if (flag == zero) {
+    param_.eval(2) = h21;
+    param_.eval(3) = h12;
+  } else {
+    param_.eval(1) = h11;
+    param_.eval(4) = h22;
+  }
+  param_.eval(0) = flag;
+  d1_.eval(0) = d1;
+  d2_.eval(0) = d2;
+  x1_.eval(0) = x1;
+  return flag;
+}
+
+template <typename d1_t, typename d2_t, typename x1_t, typename y1_t,
+          typename param_t>
+SYCL_BLAS_INLINE typename Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::value_t
+Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::eval(ndItem.get_global_id(0));
+}
+
+template <typename d1_t, typename d2_t, typename x1_t, typename y1_t,
+          typename param_t>
+SYCL_BLAS_INLINE void Rotmg<d1_t, d2_t, x1_t, y1_t, param_t>::bind(
+    cl::sycl::handler &h) {
+  d1_.bind(h);
+  d2_.bind(h);
+  x1_.bind(h);
+  y1_.bind(h);
+  param_.bind(h);
+}
+
+/*! BatchedRot.
+ * @brief Applies one conflict-free round of plane rotations.
+ */
+template <typename vector_t, typename index_vector_t,
+          typename scalar_vector_t>
+BatchedRot<vector_t, index_vector_t, scalar_vector_t>::BatchedRot(
+    vector_t &_vx, index_vector_t &_rows_i, index_vector_t &_rows_j,
+    index_vector_t &_ids, scalar_vector_t &_cos, scalar_vector_t &_sin,
+    index_t _N, index_t _inc, index_t _stride, index_t _begin,
+    index_t _num_rotations)
+    : vx_(_vx),
+      rows_i_(_rows_i),
+      rows_j_(_rows_j),
+      ids_(_ids),
+      cos_(_cos),
+      sin_(_sin),
+      N_(_N),
+      inc_(_inc),
+      stride_(_stride),
+      begin_(_begin),
+      num_rotations_(_num_rotations) {}
+
+template <typename vector_t, typename index_vector_t,
+          typename scalar_vector_t>
+SYCL_BLAS_INLINE
+    typename BatchedRot<vector_t, index_vector_t, scalar_vector_t>::index_t
+    BatchedRot<vector_t, index_vector_t, scalar_vector_t>::get_size() const {
+  return N_ * num_rotations_;
+}
+
+template <typename vector_t, typename index_vector_t,
+          typename scalar_vector_t>
+SYCL_BLAS_INLINE bool
+BatchedRot<vector_t, index_vector_t, scalar_vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) <
+           BatchedRot<vector_t, index_vector_t, scalar_vector_t>::get_size()));
+}
+
+template <typename vector_t, typename index_vector_t,
+          typename scalar_vector_t>
+SYCL_BLAS_INLINE
+    typename BatchedRot<vector_t, index_vector_t, scalar_vector_t>::value_t
+    BatchedRot<vector_t, index_vector_t, scalar_vector_t>::eval(
+        typename BatchedRot<vector_t, index_vector_t,
+                            scalar_vector_t>::index_t i) {
+  const index_t slot = begin_ + i / N_;
+  const index_t elem = (i % N_) * inc_;
+  const index_t rot = ids_.eval(slot);
+  const index_t pos_x = rows_i_.eval(slot) * stride_ + elem;
+  const index_t pos_y = rows_j_.eval(slot) * stride_ + elem;
+  const value_t c = cos_.eval(rot);
+  const value_t s = sin_.eval(rot);
+  const value_t x = vx_.eval(pos_x);
+  const value_t y = vx_.eval(pos_y);
+  const value_t new_x = c * x + s * y;
+  vx_.eval(pos_x) = new_x;
+  vx_.eval(pos_y) = c * y - s * x;
+  return new_x;
+}
+
+template <typename vector_t, typename index_vector_t,
+          typename scalar_vector_t>
+SYCL_BLAS_INLINE
+    typename BatchedRot<vector_t, index_vector_t, scalar_vector_t>::value_t
+    BatchedRot<vector_t, index_vector_t, scalar_vector_t>::eval(
+        cl::sycl::nd_item<1> ndItem) {
+  return BatchedRot<vector_t, index_vector_t, scalar_vector_t>::eval(
+      ndItem.get_global_id(0));
+}
+
+template <typename vector_t, typename index_vector_t,
+          typename scalar_vector_t>
+SYCL_BLAS_INLINE void
+BatchedRot<vector_t, index_vector_t, scalar_vector_t>::bind(
+    cl::sycl::handler &h) {
+  vx_.bind(h);
+  rows_i_.bind(h);
+  rows_j_.bind(h);
+  ids_.bind(h);
+  cos_.bind(h);
+  sin_.bind(h);
+}
+
 /*! TupleOp.
  * @brief Implements a Tuple Operation (map (\x -> [i, x]) vector).
  */
@@ -372,6 +881,216 @@ SYCL_BLAS_INLINE void TupleOp<rhs_t>::bind(cl::sycl::handler &h) {
   rhs_.bind(h);
 }
 
+/*! AccumulatorOp.
+ * @brief Lifts each element to the accumulator type of a reduction operator
+ * (map (\x -> operator_t::lift(x)) vector).
+ */
+template <typename operator_t, typename rhs_t>
+AccumulatorOp<operator_t, rhs_t>::AccumulatorOp(rhs_t &_r) : rhs_(_r) {}
+
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE typename AccumulatorOp<operator_t, rhs_t>::index_t
+AccumulatorOp<operator_t, rhs_t>::get_size() const {
+  return rhs_.get_size();
+}
+
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE bool AccumulatorOp<operator_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) < get_size()));
+}
+
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE typename AccumulatorOp<operator_t, rhs_t>::value_t
+AccumulatorOp<operator_t, rhs_t>::eval(
+    typename AccumulatorOp<operator_t, rhs_t>::index_t i) {
+  return operator_t::lift(rhs_.eval(i));
+}
+
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE typename AccumulatorOp<operator_t, rhs_t>::value_t
+AccumulatorOp<operator_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return AccumulatorOp<operator_t, rhs_t>::eval(ndItem.get_global_id(0));
+}
+
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE void AccumulatorOp<operator_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  rhs_.bind(h);
+}
+
+/*! PairwiseOp.
+ * @brief Reduces each contiguous block of a vector as a balanced binary tree.
+ */
+template <typename operator_t, typename rhs_t>
+PairwiseOp<operator_t, rhs_t>::PairwiseOp(rhs_t &_r, index_t _num_blocks)
+    : rhs_(_r),
+      num_blocks_(_num_blocks),
+      block_size_((_r.get_size() + _num_blocks - 1) / _num_blocks) {}
+
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE typename PairwiseOp<operator_t, rhs_t>::index_t
+PairwiseOp<operator_t, rhs_t>::get_size() const {
+  return num_blocks_;
+}
+
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE bool PairwiseOp<operator_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) < get_size()));
+}
+
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE typename PairwiseOp<operator_t, rhs_t>::value_t
+PairwiseOp<operator_t, rhs_t>::eval(
+    typename PairwiseOp<operator_t, rhs_t>::index_t i) {
+  const index_t size = rhs_.get_size();
+  const index_t first = i * block_size_;
+  const index_t last =
+      (first + block_size_ < size) ? (first + block_size_) : size;
+  // partial[l] holds a complete subtree, of more elements than partial[l + 1]
+  value_t partial[max_levels];
+  int levels = 0;
+  for (index_t j = first; j < last; j++) {
+    value_t val = rhs_.eval(j);
+    // As in a binary counter, the element completes one subtree per trailing
+    // one bit of the number of elements before it
+    for (index_t count = j - first; count & 1; count >>= 1) {
+      val = operator_t::eval(partial[--levels], val);
+    }
+    partial[levels++] = val;
+  }
+  value_t val = operator_t::template init<rhs_t>();
+  while (levels > 0) {
+    val = operator_t::eval(partial[--levels], val);
+  }
+  return val;
+}
+
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE typename PairwiseOp<operator_t, rhs_t>::value_t
+PairwiseOp<operator_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return PairwiseOp<operator_t, rhs_t>::eval(ndItem.get_global_id(0));
+}
+
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE void PairwiseOp<operator_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  rhs_.bind(h);
+}
+
+/*! ChunkedOp.
+ * @brief Evaluates an element-wise tree with a grid-stride loop, each work
+ * item processing chunk_size elements per iteration.
+ */
+template <typename tree_t, int chunk_size, bool vectorised>
+ChunkedOp<tree_t, chunk_size, vectorised>::ChunkedOp(tree_t &_t)
+    : tree_(_t) {}
+
+template <typename tree_t, int chunk_size, bool vectorised>
+SYCL_BLAS_INLINE typename ChunkedOp<tree_t, chunk_size, vectorised>::index_t
+ChunkedOp<tree_t, chunk_size, vectorised>::get_size() const {
+  return tree_.get_size();
+}
+
+template <typename tree_t, int chunk_size, bool vectorised>
+SYCL_BLAS_INLINE bool ChunkedOp<tree_t, chunk_size, vectorised>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // The bounds are checked inside the grid-stride loop
+  return true;
+}
+
+template <typename tree_t, int chunk_size, bool vectorised>
+SYCL_BLAS_INLINE void ChunkedOp<tree_t, chunk_size, vectorised>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  internal::ChunkEvaluator<vectorised>::template eval<chunk_size>(tree_,
+                                                                  ndItem);
+}
+
+template <typename tree_t, int chunk_size, bool vectorised>
+SYCL_BLAS_INLINE void ChunkedOp<tree_t, chunk_size, vectorised>::bind(
+    cl::sycl::handler &h) {
+  tree_.bind(h);
+}
+
+/*! DeferredOp.
+ */
+template <typename view_t, int slots>
+DeferredOp<view_t, slots>::DeferredOp(view_t &_v)
+    : x_(_v),
+      y_(_v),
+      alpha_(0),
+      accumulate_(false),
+      active_(false),
+      next_(_v) {}
+
+template <typename view_t, int slots>
+void DeferredOp<view_t, slots>::set(int slot, view_t &_x, view_t &_y,
+                                    value_t _alpha, bool _accumulate) {
+  if (slot > 0) {
+    next_.set(slot - 1, _x, _y, _alpha, _accumulate);
+    return;
+  }
+  x_ = _x;
+  y_ = _y;
+  alpha_ = _alpha;
+  accumulate_ = _accumulate;
+  active_ = true;
+}
+
+template <typename view_t, int slots>
+SYCL_BLAS_INLINE typename DeferredOp<view_t, slots>::index_t
+DeferredOp<view_t, slots>::get_size() const {
+  return y_.get_size();
+}
+
+template <typename view_t, int slots>
+SYCL_BLAS_INLINE void DeferredOp<view_t, slots>::eval(
+    typename DeferredOp<view_t, slots>::index_t i) {
+  if (active_) {
+    const value_t val = alpha_ * x_.eval(i);
+    y_.eval(i) = accumulate_ ? y_.eval(i) + val : val;
+  }
+  next_.eval(i);
+}
+
+template <typename view_t, int slots>
+template <int width>
+SYCL_BLAS_INLINE void DeferredOp<view_t, slots>::eval_vec(
+    typename DeferredOp<view_t, slots>::index_t i) {
+  if (active_) {
+    const auto val = x_.template eval_vec<width>(i) * alpha_;
+    y_.template store_vec<width>(
+        i, accumulate_ ? y_.template eval_vec<width>(i) + val : val);
+  }
+  next_.template eval_vec<width>(i);
+}
+
+template <typename view_t, int slots>
+SYCL_BLAS_INLINE void DeferredOp<view_t, slots>::bind(cl::sycl::handler &h) {
+  x_.bind(h);
+  y_.bind(h);
+  next_.bind(h);
+}
+
+template <typename view_t>
+DeferredOp<view_t, 0>::DeferredOp(view_t &) {}
+
+template <typename view_t>
+void DeferredOp<view_t, 0>::set(int, view_t &, view_t &, value_t, bool) {}
+
+template <typename view_t>
+SYCL_BLAS_INLINE void DeferredOp<view_t, 0>::eval(
+    typename DeferredOp<view_t, 0>::index_t) {}
+
+template <typename view_t>
+template <int width>
+SYCL_BLAS_INLINE void DeferredOp<view_t, 0>::eval_vec(
+    typename DeferredOp<view_t, 0>::index_t) {}
+
+template <typename view_t>
+SYCL_BLAS_INLINE void DeferredOp<view_t, 0>::bind(cl::sycl::handler &) {}
+
 /*! AssignReduction.
  * @brief Implements the reduction operation for assignments (in the form y
  * = x) with y a scalar and x a subexpression tree.
@@ -419,7 +1138,8 @@ AssignReduction<operator_t, lhs_t, rhs_t>::eval(
     val = operator_t::eval(val, local_val);
   }
   if (i < lhs_.get_size()) {
-    lhs_.eval(i) = val;
+    lhs_.eval(i) = internal::ReductionFinaliser<
+        operator_t, typename lhs_t::value_t, value_t>::eval(val);
   }
   return val;
 }
@@ -465,9 +1185,11 @@ AssignReduction<operator_t, lhs_t, rhs_t>::eval(sharedT scratch,
     ndItem.barrier(cl::sycl::access::fence_space::local_space);
   }
   if (localid == 0) {
-    lhs_.eval(groupid) = scratch[localid];
+    val = scratch[localid];
+    lhs_.eval(groupid) = internal::ReductionFinaliser<
+        operator_t, typename lhs_t::value_t, value_t>::eval(val);
   }
-  return lhs_.eval(groupid);
+  return scratch[0];
 }
 
 template <typename operator_t, typename lhs_t, typename rhs_t>
@@ -477,6 +1199,74 @@ SYCL_BLAS_INLINE void AssignReduction<operator_t, lhs_t, rhs_t>::bind(
   rhs_.bind(h);
 }
 
+/*! AssignBatchedReduction.
+ * @brief Reduces every vector of a batch in its own work group.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t>
+AssignBatchedReduction<operator_t, lhs_t, rhs_t>::AssignBatchedReduction(
+    lhs_t &_l, rhs_t &_r, index_t _vector_size)
+    : lhs_(_l), rhs_(_r), vector_size_(_vector_size){};
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE
+    typename AssignBatchedReduction<operator_t, lhs_t, rhs_t>::index_t
+    AssignBatchedReduction<operator_t, lhs_t, rhs_t>::get_size() const {
+  return rhs_.get_size();
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE bool
+AssignBatchedReduction<operator_t, lhs_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE
+    typename AssignBatchedReduction<operator_t, lhs_t, rhs_t>::value_t
+    AssignBatchedReduction<operator_t, lhs_t, rhs_t>::eval(
+        sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t batch = ndItem.get_group(0);
+  index_t frs_elem = batch * vector_size_;
+
+  // Reduction across the vector of this work group
+  static constexpr value_t init_val = operator_t::template init<rhs_t>();
+  value_t val = init_val;
+  for (index_t k = localid; k < vector_size_; k += localSz) {
+    val = operator_t::eval(val, rhs_.eval(frs_elem + k));
+  }
+
+  scratch[localid] = val;
+  // This barrier is mandatory to be sure the data is on the shared memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Reduction inside the block
+  for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
+    if (localid < offset) {
+      scratch[localid] =
+          operator_t::eval(scratch[localid], scratch[localid + offset]);
+    }
+    // This barrier is mandatory to be sure the data are on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+  if (localid == 0) {
+    val = scratch[localid];
+    lhs_.eval(batch) = internal::ReductionFinaliser<
+        operator_t, typename lhs_t::value_t, value_t>::eval(val);
+  }
+  return scratch[0];
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE void AssignBatchedReduction<operator_t, lhs_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+}
+
 }  // namespace blas
 
 #endif  // BLAS1_TREES_HPP
@@ -0,0 +1,190 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename banded.hpp
+ *
+ **************************************************************************/
+
+#ifndef BANDED_HPP
+#define BANDED_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/**** GBMV, ONE ELEMENT OF THE OUTPUT PER WORK ITEM ****/
+/**
+ * @struct Gbmv
+ * @brief Tree node computing a banded matrix vector product.
+ */
+template <bool Trans, bool Unit, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::Gbmv(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+    typename Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::index_t _kl,
+    typename Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::index_t _ku,
+    typename Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::value_t _alpha,
+    typename Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::value_t _beta)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      kl_(_kl),
+      ku_(_ku),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+template <bool Trans, bool Unit, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE typename Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::index_t
+Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <bool Trans, bool Unit, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE bool
+Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <bool Trans, bool Unit, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE typename Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::value_t
+Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::eval(
+    typename Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::index_t i) {
+  using index_t =
+      typename Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::index_t;
+  using value_t =
+      typename Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::value_t;
+  const value_t zero = constant<value_t, const_val::zero>::value();
+  const value_t one = constant<value_t, const_val::one>::value();
+  const index_t dimIn = vector_.get_size();
+
+  // Row i of A holds the columns i - kl .. i + ku, column i of A the rows
+  // i - ku .. i + kl
+  const index_t lo = Trans ? ku_ : kl_;
+  const index_t hi = Trans ? kl_ : ku_;
+  const index_t jBegin = (i > lo) ? i - lo : 0;
+  const index_t jEnd = std::min(dimIn, i + hi + 1);
+
+  value_t val = zero;
+  for (index_t j = jBegin; j < jEnd; j++) {
+    // A(i, j) is stored at (ku + i - j, j) and A(j, i) at (ku + j - i, i)
+    const value_t elem = (Unit && i == j) ? one
+                         : (Trans)        ? matrix_.eval(ku_ + j - i, i)
+                                          : matrix_.eval(ku_ + i - j, j);
+    val = AddOperator::eval(val, ProductOperator::eval(elem, vector_.eval(j)));
+  }
+  val = alpha_ * val;
+  return lhs_.eval(i) = (beta_ == zero) ? val : val + beta_ * lhs_.eval(i);
+}
+
+template <bool Trans, bool Unit, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE typename Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::value_t
+Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  return Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::eval(
+      ndItem.get_global_id(0));
+}
+
+template <bool Trans, bool Unit, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE void Gbmv<Trans, Unit, lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+/**** SBMV, ONE ELEMENT OF THE OUTPUT PER WORK ITEM ****/
+/**
+ * @struct Sbmv
+ * @brief Tree node computing a symmetric banded matrix vector product.
+ */
+template <bool Upper, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE Sbmv<Upper, lhs_t, matrix_t, vector_t>::Sbmv(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+    typename Sbmv<Upper, lhs_t, matrix_t, vector_t>::index_t _k,
+    typename Sbmv<Upper, lhs_t, matrix_t, vector_t>::value_t _alpha,
+    typename Sbmv<Upper, lhs_t, matrix_t, vector_t>::value_t _beta)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      k_(_k),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+template <bool Upper, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Sbmv<Upper, lhs_t, matrix_t, vector_t>::index_t
+Sbmv<Upper, lhs_t, matrix_t, vector_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <bool Upper, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE bool Sbmv<Upper, lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <bool Upper, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Sbmv<Upper, lhs_t, matrix_t, vector_t>::value_t
+Sbmv<Upper, lhs_t, matrix_t, vector_t>::eval(
+    typename Sbmv<Upper, lhs_t, matrix_t, vector_t>::index_t i) {
+  using index_t = typename Sbmv<Upper, lhs_t, matrix_t, vector_t>::index_t;
+  using value_t = typename Sbmv<Upper, lhs_t, matrix_t, vector_t>::value_t;
+  const value_t zero = constant<value_t, const_val::zero>::value();
+  const index_t dim = vector_.get_size();
+  const index_t jBegin = (i > k_) ? i - k_ : 0;
+  const index_t jEnd = std::min(dim, i + k_ + 1);
+
+  value_t val = zero;
+  for (index_t j = jBegin; j < jEnd; j++) {
+    // Only the element (r, c) of the stored triangle is read for A(i, j)
+    const index_t r = ((i <= j) == Upper) ? i : j;
+    const index_t c = ((i <= j) == Upper) ? j : i;
+    const value_t elem =
+        (Upper) ? matrix_.eval(k_ + r - c, c) : matrix_.eval(r - c, c);
+    val = AddOperator::eval(val, ProductOperator::eval(elem, vector_.eval(j)));
+  }
+  val = alpha_ * val;
+  return lhs_.eval(i) = (beta_ == zero) ? val : val + beta_ * lhs_.eval(i);
+}
+
+template <bool Upper, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Sbmv<Upper, lhs_t, matrix_t, vector_t>::value_t
+Sbmv<Upper, lhs_t, matrix_t, vector_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return Sbmv<Upper, lhs_t, matrix_t, vector_t>::eval(ndItem.get_global_id(0));
+}
+
+template <bool Upper, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void Sbmv<Upper, lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+}  // namespace blas
+#endif  // BANDED_HPP
@@ -390,6 +390,343 @@ SYCL_BLAS_INLINE void GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t,
   vector_.bind(h);
 }
 
+/**** GEMV IN A SINGLE PASS, ONE ROW PER WORK ITEM OR PER WORK GROUP ****/
+/**
+ * @struct GemvSinglePass
+ * @brief Tree node computing y = alpha * A * x + beta * y in a single kernel.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE GemvSinglePass<lhs_t, matrix_t, vector_t>::GemvSinglePass(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+    typename GemvSinglePass<lhs_t, matrix_t, vector_t>::value_t _alpha,
+    typename GemvSinglePass<lhs_t, matrix_t, vector_t>::value_t _beta,
+    typename GemvSinglePass<lhs_t, matrix_t, vector_t>::index_t _nWG)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      alpha_(_alpha),
+      beta_(_beta),
+      nWG_(_nWG) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename GemvSinglePass<lhs_t, matrix_t, vector_t>::index_t
+GemvSinglePass<lhs_t, matrix_t, vector_t>::get_size() const {
+  return matrix_.get_size_row();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE bool
+GemvSinglePass<lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename GemvSinglePass<lhs_t, matrix_t, vector_t>::value_t
+GemvSinglePass<lhs_t, matrix_t, vector_t>::eval(local_memory_t shrMem,
+                                                cl::sycl::nd_item<1> ndItem) {
+  using index_t = typename GemvSinglePass<lhs_t, matrix_t, vector_t>::index_t;
+  using value_t = typename GemvSinglePass<lhs_t, matrix_t, vector_t>::value_t;
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t groupid = ndItem.get_group(0);
+
+  index_t dimR = matrix_.get_size_row();
+  index_t dimC = matrix_.get_size_col();
+  static constexpr value_t init_val = AddOperator::template init<vector_t>();
+  const value_t zero = constant<value_t, const_val::zero>::value();
+  value_t val = init_val;
+
+  if (matrix_.is_row_access()) {
+    // The elements of a row are contiguous: a work group reduces each row,
+    // the work items striding along the columns
+    for (index_t id_row = groupid; id_row < dimR; id_row += nWG_) {
+      val = init_val;
+      for (index_t id_col = localid; id_col < dimC; id_col += localSz) {
+        auto prod = ProductOperator::eval(matrix_.eval(id_row, id_col),
+                                          vector_.eval(id_col));
+        val = AddOperator::eval(val, prod);
+      }
+      shrMem[localid] = val;
+      // This barrier is mandatory to be sure the data is on the shared memory
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+      // Reduction inside the block
+      for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
+        if (localid < offset) {
+          shrMem[localid] =
+              AddOperator::eval(shrMem[localid], shrMem[localid + offset]);
+        }
+        // This barrier is mandatory to be sure the data are on the shared
+        // memory
+        ndItem.barrier(cl::sycl::access::fence_space::local_space);
+      }
+      if (localid == 0) {
+        val = alpha_ * shrMem[0];
+        lhs_.eval(id_row) =
+            (beta_ == zero) ? val : val + beta_ * lhs_.eval(id_row);
+      }
+    }
+  } else {
+    // The elements of a column are contiguous: each work item reduces one row
+    // while the work group stages blocks of x in the shared memory
+    index_t id_row = groupid * localSz + localid;
+    for (index_t colid = 0; colid < dimC; colid += localSz) {
+      auto blqSz = std::min(localSz, dimC - colid);
+      if (localid < blqSz) {
+        shrMem[localid] = vector_.eval(colid + localid);
+      }
+      // This barrier is mandatory to be sure the data is on the shared memory
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+      if (id_row < dimR) {
+        for (index_t col = 0; col < blqSz; col++) {
+          auto prod = ProductOperator::eval(matrix_.eval(id_row, colid + col),
+                                            shrMem[col]);
+          val = AddOperator::eval(val, prod);
+        }
+      }
+      // The block can only be overwritten once every work item used it
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+    if (id_row < dimR) {
+      val = alpha_ * val;
+      lhs_.eval(id_row) =
+          (beta_ == zero) ? val : val + beta_ * lhs_.eval(id_row);
+    }
+  }
+  return val;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void GemvSinglePass<lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+/**** BATCHED GEMV, ONE PROBLEM PER WORK GROUP ****/
+/**
+ * @struct GemvBatched
+ * @brief Tree node computing a batch of independent GEMVs in one kernel.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE GemvBatched<lhs_t, matrix_t, vector_t>::GemvBatched(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+    typename GemvBatched<lhs_t, matrix_t, vector_t>::value_t _alpha,
+    typename GemvBatched<lhs_t, matrix_t, vector_t>::value_t _beta,
+    typename GemvBatched<lhs_t, matrix_t, vector_t>::increment_t _incx,
+    typename GemvBatched<lhs_t, matrix_t, vector_t>::increment_t _incy,
+    typename GemvBatched<lhs_t, matrix_t, vector_t>::index_t _strideA,
+    typename GemvBatched<lhs_t, matrix_t, vector_t>::index_t _stridex,
+    typename GemvBatched<lhs_t, matrix_t, vector_t>::index_t _stridey,
+    typename GemvBatched<lhs_t, matrix_t, vector_t>::index_t _batch_size,
+    typename GemvBatched<lhs_t, matrix_t, vector_t>::index_t _nWG)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      alpha_(_alpha),
+      beta_(_beta),
+      incx_(_incx),
+      incy_(_incy),
+      strideA_(_strideA),
+      stridex_(_stridex),
+      stridey_(_stridey),
+      batch_size_(_batch_size),
+      nWG_(_nWG) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename GemvBatched<lhs_t, matrix_t, vector_t>::index_t
+GemvBatched<lhs_t, matrix_t, vector_t>::get_size() const {
+  return matrix_.get_size_row() * batch_size_;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE bool GemvBatched<lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename GemvBatched<lhs_t, matrix_t, vector_t>::value_t
+GemvBatched<lhs_t, matrix_t, vector_t>::eval(local_memory_t shrMem,
+                                             cl::sycl::nd_item<1> ndItem) {
+  using index_t = typename GemvBatched<lhs_t, matrix_t, vector_t>::index_t;
+  using value_t = typename GemvBatched<lhs_t, matrix_t, vector_t>::value_t;
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t groupid = ndItem.get_group(0);
+
+  index_t dimR = matrix_.get_size_row();
+  index_t dimC = matrix_.get_size_col();
+  static constexpr value_t init_val = AddOperator::template init<vector_t>();
+  const value_t zero = constant<value_t, const_val::zero>::value();
+  value_t val = init_val;
+
+  for (index_t batch = groupid; batch < batch_size_; batch += nWG_) {
+    const index_t offA = batch * strideA_;
+    const index_t offx = batch * stridex_;
+    const index_t offy = batch * stridey_;
+    for (index_t rowBase = 0; rowBase < dimR; rowBase += localSz) {
+      index_t id_row = rowBase + localid;
+      val = init_val;
+      for (index_t colid = 0; colid < dimC; colid += localSz) {
+        auto blqSz = std::min(localSz, dimC - colid);
+        if (localid < blqSz) {
+          index_t j = colid + localid;
+          shrMem[localid] = vector_.eval(
+              offx + ((incx_ > 0) ? j * incx_ : (dimC - 1 - j) * (-incx_)));
+        }
+        // This barrier is mandatory to be sure the data is on the shared
+        // memory
+        ndItem.barrier(cl::sycl::access::fence_space::local_space);
+        if (id_row < dimR) {
+          for (index_t col = 0; col < blqSz; col++) {
+            // The matrix of the problem starts offA elements further along
+            // the contiguous dimension
+            auto elem = (matrix_.is_row_access())
+                            ? matrix_.eval(id_row, offA + colid + col)
+                            : matrix_.eval(offA + id_row, colid + col);
+            val = AddOperator::eval(val,
+                                    ProductOperator::eval(elem, shrMem[col]));
+          }
+        }
+        // The block can only be overwritten once every work item used it
+        ndItem.barrier(cl::sycl::access::fence_space::local_space);
+      }
+      if (id_row < dimR) {
+        index_t id_y = offy + ((incy_ > 0) ? id_row * incy_
+                                           : (dimR - 1 - id_row) * (-incy_));
+        val = alpha_ * val;
+        lhs_.eval(id_y) = (beta_ == zero) ? val : val + beta_ * lhs_.eval(id_y);
+      }
+    }
+  }
+  return val;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void GemvBatched<lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+/**** GEMV WITH SEVERAL RIGHT HAND SIDE VECTORS ****/
+/**
+ * @struct GemvMultiVector
+ * @brief Tree node computing a GEMV for several vectors reading A once.
+ */
+template <int max_vectors, typename lhs_t, typename matrix_t, typename rhs_t>
+SYCL_BLAS_INLINE
+GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::GemvMultiVector(
+    lhs_t &_l, matrix_t &_matrix, rhs_t &_rhs,
+    typename GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::value_t
+        _alpha,
+    typename GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::value_t
+        _beta,
+    typename GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::index_t
+        _first,
+    typename GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::index_t
+        _num)
+    : lhs_(_l),
+      matrix_(_matrix),
+      rhs_(_rhs),
+      alpha_(_alpha),
+      beta_(_beta),
+      first_(_first),
+      num_(_num) {}
+
+template <int max_vectors, typename lhs_t, typename matrix_t, typename rhs_t>
+SYCL_BLAS_INLINE typename GemvMultiVector<max_vectors, lhs_t, matrix_t,
+                                          rhs_t>::index_t
+GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::get_size() const {
+  return matrix_.get_size_row();
+}
+
+template <int max_vectors, typename lhs_t, typename matrix_t, typename rhs_t>
+SYCL_BLAS_INLINE bool
+GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <int max_vectors, typename lhs_t, typename matrix_t, typename rhs_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename GemvMultiVector<max_vectors, lhs_t, matrix_t,
+                                          rhs_t>::value_t
+GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::eval(
+    local_memory_t shrMem, cl::sycl::nd_item<1> ndItem) {
+  using index_t =
+      typename GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::index_t;
+  using value_t =
+      typename GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::value_t;
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t groupid = ndItem.get_group(0);
+
+  index_t dimR = matrix_.get_size_row();
+  index_t dimC = matrix_.get_size_col();
+  static constexpr value_t init_val = AddOperator::template init<rhs_t>();
+  const value_t zero = constant<value_t, const_val::zero>::value();
+
+  index_t id_row = groupid * localSz + localid;
+  value_t acc[max_vectors];
+#pragma unroll
+  for (int v = 0; v < max_vectors; v++) {
+    acc[v] = init_val;
+  }
+
+  for (index_t colid = 0; colid < dimC; colid += localSz) {
+    auto blqSz = std::min(localSz, dimC - colid);
+    // The block of each vector is stored after the one of the previous vector
+    if (localid < blqSz) {
+#pragma unroll
+      for (int v = 0; v < max_vectors; v++) {
+        if (v < num_) {
+          shrMem[v * localSz + localid] =
+              rhs_.eval(colid + localid, first_ + v);
+        }
+      }
+    }
+    // This barrier is mandatory to be sure the data is on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    if (id_row < dimR) {
+      for (index_t col = 0; col < blqSz; col++) {
+        auto elem = matrix_.eval(id_row, colid + col);
+#pragma unroll
+        for (int v = 0; v < max_vectors; v++) {
+          if (v < num_) {
+            acc[v] = AddOperator::eval(
+                acc[v], ProductOperator::eval(elem, shrMem[v * localSz + col]));
+          }
+        }
+      }
+    }
+    // The block can only be overwritten once every work item used it
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+  if (id_row < dimR) {
+    for (index_t v = 0; v < num_; v++) {
+      value_t val = alpha_ * acc[v];
+      lhs_.eval(id_row, first_ + v) =
+          (beta_ == zero) ? val : val + beta_ * lhs_.eval(id_row, first_ + v);
+    }
+  }
+  return acc[0];
+}
+
+template <int max_vectors, typename lhs_t, typename matrix_t, typename rhs_t>
+SYCL_BLAS_INLINE void
+GemvMultiVector<max_vectors, lhs_t, matrix_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  rhs_.bind(h);
+}
+
 /**** GEMV BY COLUMNS 1 ROW x M BLOCKS USING PROPERLY THE SHARED MEMORY ****/
 
 /**
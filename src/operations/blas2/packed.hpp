@@ -0,0 +1,250 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename packed.hpp
+ *
+ **************************************************************************/
+
+#ifndef PACKED_HPP
+#define PACKED_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/*!
+ * @brief Position of the element (r, c) of the stored triangle of an n x n
+ * matrix packed column by column. r <= c for the upper triangle and r >= c
+ * for the lower one.
+ */
+template <bool Upper, typename index_t>
+SYCL_BLAS_INLINE index_t packed_index(index_t r, index_t c, index_t n) {
+  return (Upper) ? r + (c * (c + 1)) / 2 : r + ((2 * n - c - 1) * c) / 2;
+}
+
+/**** SPMV, ONE ELEMENT OF THE OUTPUT PER WORK ITEM ****/
+/**
+ * @struct Spmv
+ * @brief Tree node computing a packed symmetric matrix vector product.
+ */
+template <bool Upper, typename lhs_t, typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE Spmv<Upper, lhs_t, packed_t, vector_t>::Spmv(
+    lhs_t &_l, packed_t &_packed, vector_t &_vector,
+    typename Spmv<Upper, lhs_t, packed_t, vector_t>::value_t _alpha,
+    typename Spmv<Upper, lhs_t, packed_t, vector_t>::value_t _beta)
+    : lhs_(_l),
+      packed_(_packed),
+      vector_(_vector),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+template <bool Upper, typename lhs_t, typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE typename Spmv<Upper, lhs_t, packed_t, vector_t>::index_t
+Spmv<Upper, lhs_t, packed_t, vector_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <bool Upper, typename lhs_t, typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE bool Spmv<Upper, lhs_t, packed_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <bool Upper, typename lhs_t, typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE typename Spmv<Upper, lhs_t, packed_t, vector_t>::value_t
+Spmv<Upper, lhs_t, packed_t, vector_t>::eval(
+    typename Spmv<Upper, lhs_t, packed_t, vector_t>::index_t i) {
+  using index_t = typename Spmv<Upper, lhs_t, packed_t, vector_t>::index_t;
+  using value_t = typename Spmv<Upper, lhs_t, packed_t, vector_t>::value_t;
+  const value_t zero = constant<value_t, const_val::zero>::value();
+  const index_t dim = vector_.get_size();
+
+  value_t val = zero;
+  for (index_t j = 0; j < dim; j++) {
+    // A(i, j) is read from the element (r, c) of the stored triangle
+    const index_t r = ((i <= j) == Upper) ? i : j;
+    const index_t c = ((i <= j) == Upper) ? j : i;
+    const value_t elem = packed_.eval(packed_index<Upper>(r, c, dim));
+    val = AddOperator::eval(val, ProductOperator::eval(elem, vector_.eval(j)));
+  }
+  val = alpha_ * val;
+  return lhs_.eval(i) = (beta_ == zero) ? val : val + beta_ * lhs_.eval(i);
+}
+
+template <bool Upper, typename lhs_t, typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE typename Spmv<Upper, lhs_t, packed_t, vector_t>::value_t
+Spmv<Upper, lhs_t, packed_t, vector_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return Spmv<Upper, lhs_t, packed_t, vector_t>::eval(ndItem.get_global_id(0));
+}
+
+template <bool Upper, typename lhs_t, typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE void Spmv<Upper, lhs_t, packed_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  packed_.bind(h);
+  vector_.bind(h);
+}
+
+/**** TPMV, ONE ELEMENT OF THE OUTPUT PER WORK ITEM ****/
+/**
+ * @struct Tpmv
+ * @brief Tree node computing a packed triangular matrix vector product.
+ */
+template <bool Upper, bool Trans, bool Unit, typename lhs_t,
+          typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>::Tpmv(
+    lhs_t &_l, packed_t &_packed, vector_t &_vector)
+    : lhs_(_l), packed_(_packed), vector_(_vector) {}
+
+template <bool Upper, bool Trans, bool Unit, typename lhs_t,
+          typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE typename Tpmv<Upper, Trans, Unit, lhs_t, packed_t,
+                               vector_t>::index_t
+Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <bool Upper, bool Trans, bool Unit, typename lhs_t,
+          typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE bool
+Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <bool Upper, bool Trans, bool Unit, typename lhs_t,
+          typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE typename Tpmv<Upper, Trans, Unit, lhs_t, packed_t,
+                               vector_t>::value_t
+Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>::eval(
+    typename Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>::index_t i) {
+  using index_t =
+      typename Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>::index_t;
+  using value_t =
+      typename Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>::value_t;
+  const value_t zero = constant<value_t, const_val::zero>::value();
+  const index_t dim = vector_.get_size();
+
+  // The non zero elements of row i of op(A) are on the right of the diagonal
+  // for an upper matrix and on the left for a lower one, the other way around
+  // when the matrix is transposed
+  const index_t jBegin = (Upper != Trans) ? i : 0;
+  const index_t jEnd = (Upper != Trans) ? dim : i + 1;
+
+  value_t val = zero;
+  for (index_t j = jBegin; j < jEnd; j++) {
+    const value_t elem =
+        (Unit && i == j)
+            ? constant<value_t, const_val::one>::value()
+            : packed_.eval((Trans) ? packed_index<Upper>(j, i, dim)
+                                   : packed_index<Upper>(i, j, dim));
+    val = AddOperator::eval(val, ProductOperator::eval(elem, vector_.eval(j)));
+  }
+  return lhs_.eval(i) = val;
+}
+
+template <bool Upper, bool Trans, bool Unit, typename lhs_t,
+          typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE typename Tpmv<Upper, Trans, Unit, lhs_t, packed_t,
+                               vector_t>::value_t
+Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  return Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>::eval(
+      ndItem.get_global_id(0));
+}
+
+template <bool Upper, bool Trans, bool Unit, typename lhs_t,
+          typename packed_t, typename vector_t>
+SYCL_BLAS_INLINE void
+Tpmv<Upper, Trans, Unit, lhs_t, packed_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  packed_.bind(h);
+  vector_.bind(h);
+}
+
+/**** SPR, ONE STORED ELEMENT PER WORK ITEM ****/
+/**
+ * @struct Spr
+ * @brief Tree node computing a packed symmetric rank 1 update.
+ */
+template <bool Upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE Spr<Upper, lhs_t, vector_t>::Spr(
+    lhs_t &_l, vector_t &_vector,
+    typename Spr<Upper, lhs_t, vector_t>::value_t _alpha)
+    : lhs_(_l), vector_(_vector), alpha_(_alpha) {}
+
+template <bool Upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE typename Spr<Upper, lhs_t, vector_t>::index_t
+Spr<Upper, lhs_t, vector_t>::get_size() const {
+  const auto n = vector_.get_size();
+  return (n * (n + 1)) / 2;
+}
+
+template <bool Upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE bool Spr<Upper, lhs_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <bool Upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE typename Spr<Upper, lhs_t, vector_t>::value_t
+Spr<Upper, lhs_t, vector_t>::eval(
+    typename Spr<Upper, lhs_t, vector_t>::index_t k) {
+  using index_t = typename Spr<Upper, lhs_t, vector_t>::index_t;
+  const index_t n = vector_.get_size();
+  // The lower triangle packed by columns, read backwards, is the upper
+  // triangle of the matrix with its rows and columns reversed
+  const index_t pos = (Upper) ? k : get_size() - 1 - k;
+  // Column c of the upper triangle starts at c * (c + 1) / 2, the estimate
+  // given by the square root is corrected for rounding
+  index_t c = static_cast<index_t>(
+      (cl::sycl::sqrt(8.0f * static_cast<float>(pos) + 1.0f) - 1.0f) / 2.0f);
+  while ((c * (c + 1)) / 2 > pos) {
+    c--;
+  }
+  while (((c + 1) * (c + 2)) / 2 <= pos) {
+    c++;
+  }
+  index_t r = pos - (c * (c + 1)) / 2;
+  if (!Upper) {
+    r = n - 1 - r;
+    c = n - 1 - c;
+  }
+  return lhs_.eval(k) += alpha_ * vector_.eval(r) * vector_.eval(c);
+}
+
+template <bool Upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE typename Spr<Upper, lhs_t, vector_t>::value_t
+Spr<Upper, lhs_t, vector_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return Spr<Upper, lhs_t, vector_t>::eval(ndItem.get_global_id(0));
+}
+
+template <bool Upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE void Spr<Upper, lhs_t, vector_t>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  vector_.bind(h);
+}
+
+}  // namespace blas
+#endif  // PACKED_HPP
@@ -0,0 +1,157 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename symv.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYMV_HPP
+#define SYMV_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/**** SYMV BY TILES OF THE STORED TRIANGLE ****/
+/**
+ * @struct SymvBlocked
+ * @brief Tree node computing the partial sums of a symmetric matrix vector
+ * product, reading each element of the stored triangle once.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE SymvBlocked<lhs_t, matrix_t, vector_t>::SymvBlocked(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+    typename SymvBlocked<lhs_t, matrix_t, vector_t>::index_t _nBlocks)
+    : lhs_(_l), matrix_(_matrix), vector_(_vector), nBlocks_(_nBlocks) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename SymvBlocked<lhs_t, matrix_t, vector_t>::index_t
+SymvBlocked<lhs_t, matrix_t, vector_t>::get_size() const {
+  return matrix_.get_size_row();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE bool SymvBlocked<lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+/*
+  The matrix_ view holds the stored triangle in its upper part: element (i, j)
+  with i <= j. The shared memory holds the tile, padded to avoid bank
+  conflicts when it is read by columns, followed by the two blocks of x.
+*/
+template <typename lhs_t, typename matrix_t, typename vector_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename SymvBlocked<lhs_t, matrix_t, vector_t>::value_t
+SymvBlocked<lhs_t, matrix_t, vector_t>::eval(local_memory_t shrMem,
+                                             cl::sycl::nd_item<1> ndItem) {
+  using index_t = typename SymvBlocked<lhs_t, matrix_t, vector_t>::index_t;
+  using value_t = typename SymvBlocked<lhs_t, matrix_t, vector_t>::value_t;
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t groupid = ndItem.get_group(0);
+
+  index_t dim = matrix_.get_size_row();
+  index_t idBlqR = groupid / nBlocks_;
+  index_t idBlqC = groupid % nBlocks_;
+  static constexpr value_t init_val = AddOperator::template init<vector_t>();
+  const value_t zero = constant<value_t, const_val::zero>::value();
+
+  // Only the tiles of the stored triangle are processed, the whole work group
+  // leaves together so no barrier is left waiting
+  if (idBlqR > idBlqC) {
+    return init_val;
+  }
+
+  const index_t ld = localSz + 1;
+  const index_t xR = localSz * ld;
+  const index_t xC = xR + localSz;
+  index_t frs_row = idBlqR * localSz;
+  index_t frs_col = idBlqC * localSz;
+
+  // Load the tile, contiguous elements being read by consecutive work items
+  if (matrix_.is_row_access()) {
+    for (index_t row = 0; row < localSz; row++) {
+      const index_t id_row = frs_row + row;
+      const index_t id_col = frs_col + localid;
+      shrMem[row * ld + localid] = ((id_row < dim) && (id_col < dim))
+                                       ? matrix_.eval(id_row, id_col)
+                                       : zero;
+    }
+  } else {
+    for (index_t col = 0; col < localSz; col++) {
+      const index_t id_row = frs_row + localid;
+      const index_t id_col = frs_col + col;
+      shrMem[localid * ld + col] = ((id_row < dim) && (id_col < dim))
+                                       ? matrix_.eval(id_row, id_col)
+                                       : zero;
+    }
+  }
+  shrMem[xR + localid] =
+      (frs_row + localid < dim) ? vector_.eval(frs_row + localid) : zero;
+  shrMem[xC + localid] =
+      (frs_col + localid < dim) ? vector_.eval(frs_col + localid) : zero;
+  // This barrier is mandatory to be sure the data is on the shared memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Direct contribution to the rows of the block row. On the diagonal tile
+  // the lower part is not stored and is read from its symmetric element.
+  const bool diagonal = (idBlqR == idBlqC);
+  value_t val = init_val;
+  for (index_t col = 0; col < localSz; col++) {
+    const value_t elem = (diagonal && (localid > col))
+                             ? shrMem[col * ld + localid]
+                             : shrMem[localid * ld + col];
+    val = AddOperator::eval(val,
+                            ProductOperator::eval(elem, shrMem[xC + col]));
+  }
+  if (frs_row + localid < dim) {
+    lhs_.eval(frs_row + localid, idBlqC) = val;
+  }
+
+  // Transposed contribution to the rows of the block column
+  if (!diagonal) {
+    value_t valT = init_val;
+    for (index_t row = 0; row < localSz; row++) {
+      valT = AddOperator::eval(
+          valT, ProductOperator::eval(shrMem[row * ld + localid],
+                                      shrMem[xR + row]));
+    }
+    if (frs_col + localid < dim) {
+      lhs_.eval(frs_col + localid, idBlqR) = valT;
+    }
+  }
+  return val;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void SymvBlocked<lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+}  // namespace blas
+#endif  // SYMV_HPP
@@ -0,0 +1,141 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trsv.hpp
+ *
+ **************************************************************************/
+
+#ifndef TRSV_HPP
+#define TRSV_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/**** TRSV BY BLOCKS, ONE DIAGONAL BLOCK PER LAUNCH ****/
+/**
+ * @struct TrsvBlock
+ * @brief Tree node solving a diagonal block of a triangular system and
+ * updating the rows still to be solved.
+ */
+template <bool Lower, bool Unit, typename matrix_t, typename vector_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>::TrsvBlock(
+    matrix_t &_matrix, vector_t &_vector, rhs_t &_rhs,
+    typename TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>::index_t
+        _blockBegin)
+    : matrix_(_matrix),
+      vector_(_vector),
+      rhs_(_rhs),
+      blockBegin_(_blockBegin) {}
+
+template <bool Lower, bool Unit, typename matrix_t, typename vector_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE
+    typename TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>::index_t
+    TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>::get_size() const {
+  return vector_.get_size();
+}
+
+template <bool Lower, bool Unit, typename matrix_t, typename vector_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE bool
+TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <bool Lower, bool Unit, typename matrix_t, typename vector_t,
+          typename rhs_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE
+    typename TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>::value_t
+    TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>::eval(
+        local_memory_t shrMem, cl::sycl::nd_item<1> ndItem) {
+  using index_t =
+      typename TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>::index_t;
+  using value_t =
+      typename TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>::value_t;
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t groupid = ndItem.get_group(0);
+  index_t nGroups = ndItem.get_group_range(0);
+
+  const index_t dim = vector_.get_size();
+  const index_t blockLen = std::min(localSz, dim - blockBegin_);
+
+  // The block is read from the staged right-hand side, which is not written
+  // inside the block during this launch
+  if (localid < blockLen) {
+    shrMem[localid] = rhs_.eval(blockBegin_ + localid);
+  }
+  // This barrier is mandatory to be sure the data is on the shared memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Substitution inside the diagonal block: once x_k is final, every row
+  // still to be solved subtracts its contribution
+  for (index_t step = 0; step < blockLen; step++) {
+    const index_t k = (Lower) ? step : blockLen - 1 - step;
+    if (!Unit && localid == k) {
+      shrMem[k] /= matrix_.eval(blockBegin_ + k, blockBegin_ + k);
+    }
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    if (localid < blockLen && ((Lower) ? localid > k : localid < k)) {
+      shrMem[localid] -=
+          matrix_.eval(blockBegin_ + localid, blockBegin_ + k) * shrMem[k];
+    }
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+
+  if (groupid == 0 && localid < blockLen) {
+    vector_.eval(blockBegin_ + localid) = shrMem[localid];
+  }
+
+  // The rows still to be solved are shared between the work groups
+  const index_t restBegin = (Lower) ? blockBegin_ + blockLen : 0;
+  const index_t restEnd = (Lower) ? dim : blockBegin_;
+  value_t val = constant<value_t, const_val::zero>::value();
+  for (index_t row = restBegin + groupid * localSz + localid; row < restEnd;
+       row += nGroups * localSz) {
+    val = constant<value_t, const_val::zero>::value();
+    for (index_t j = 0; j < blockLen; j++) {
+      val = AddOperator::eval(
+          val, ProductOperator::eval(matrix_.eval(row, blockBegin_ + j),
+                                     shrMem[j]));
+    }
+    rhs_.eval(row) -= val;
+  }
+  return val;
+}
+
+template <bool Lower, bool Unit, typename matrix_t, typename vector_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE void TrsvBlock<Lower, Unit, matrix_t, vector_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  matrix_.bind(h);
+  vector_.bind(h);
+  rhs_.bind(h);
+}
+
+}  // namespace blas
+#endif  // TRSV_HPP
@@ -49,6 +49,24 @@ ENABLE_TYPE_STRING(double)
 
 #undef ENABLE_TYPE_STRING
 
+/*!
+ * @brief Returns the raw pointer to the data of a matrix view, read through
+ * an accessor with codeplay_policy.
+ */
+template <typename data_t>
+SYCL_BLAS_INLINE auto get_raw_pointer(data_t &data)
+    -> decltype(data.get_pointer().get()) {
+  return data.get_pointer().get();
+}
+
+/*!
+ * @brief As above for the device pointers of usm_policy.
+ */
+template <typename element_t>
+SYCL_BLAS_INLINE element_t *get_raw_pointer(element_t *data) {
+  return data;
+}
+
 /*!
  * @brief The Tile structure determines the tiling configuration of a gemm
  *        implementation.
@@ -253,11 +271,11 @@ SYCL_BLAS_INLINE void Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
   const index_t b_size = trans_b ? ldb_ * k_ : n_ * ldb_;
   const index_t c_size = ldc_ * n_;
 
-  auto orig_A = a_.get_data().get_pointer().get() +
+  auto orig_A = get_raw_pointer(a_.get_data()) +
                 a_.get_access_displacement() + (wg_batch_id * a_size);
-  auto orig_B = b_.get_data().get_pointer().get() +
+  auto orig_B = get_raw_pointer(b_.get_data()) +
                 b_.get_access_displacement() + (wg_batch_id * b_size);
-  auto orig_C = c_.get_data().get_pointer().get() +
+  auto orig_C = get_raw_pointer(c_.get_data()) +
                 c_.get_access_displacement() + (wg_batch_id * c_size);
 
   index_t item_id = (id.get_group(0) % get_workgroup_cluster(m_, n_)) *
@@ -483,11 +501,11 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     const index_t b_size = trans_b ? ldb_ * k_ : n_ * ldb_;
     const index_t c_size = ldc_ * n_;
 
-    auto orig_A = a_.get_data().get_pointer().get() +
+    auto orig_A = get_raw_pointer(a_.get_data()) +
                   a_.get_access_displacement() + (wg_batch_id * a_size);
-    auto orig_B = b_.get_data().get_pointer().get() +
+    auto orig_B = get_raw_pointer(b_.get_data()) +
                   b_.get_access_displacement() + (wg_batch_id * b_size);
-    auto orig_C = c_.get_data().get_pointer().get() +
+    auto orig_C = get_raw_pointer(c_.get_data()) +
                   c_.get_access_displacement() + (wg_batch_id * c_size);
 
     const index_t number_of_block_per_row = ((m_ - 1) / block_rows) + 1;
@@ -987,11 +1005,11 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
     const index_t a_size = trans_a ? m_ * lda_ : k_ * lda_;
     const index_t b_size = trans_b ? ldb_ * k_ : n_ * ldb_;
     const index_t c_size = ldc_ * n_;
-    auto orig_A = a_.get_data().get_pointer().get() +
+    auto orig_A = get_raw_pointer(a_.get_data()) +
                   a_.get_access_displacement() + (wg_batch_id * a_size);
-    auto orig_B = b_.get_data().get_pointer().get() +
+    auto orig_B = get_raw_pointer(b_.get_data()) +
                   b_.get_access_displacement() + (wg_batch_id * b_size);
-    auto orig_C = c_.get_data().get_pointer().get() +
+    auto orig_C = get_raw_pointer(c_.get_data()) +
                   c_.get_access_displacement() + (wg_batch_id * c_size);
     const index_t item_id = id.get_local_id(0);
     const index_t tile_size = tl_rows * tl_cols;
@@ -152,6 +152,10 @@ INDEX_VALUE_STRIP_ASP_LOCATION(float, long long)
 INDEX_VALUE_STRIP_ASP_LOCATION(double, int)
 INDEX_VALUE_STRIP_ASP_LOCATION(double, long)
 INDEX_VALUE_STRIP_ASP_LOCATION(double, long long)
+GENERATE_STRIP_ASP_LOCATION(ScaledSumSqTuple<float>)
+GENERATE_STRIP_ASP_LOCATION(ScaledSumSqTuple<double>)
+GENERATE_STRIP_ASP_LOCATION(CompensatedSumTuple<float>)
+GENERATE_STRIP_ASP_LOCATION(CompensatedSumTuple<double>)
 #endif
 
 /*!
@@ -201,6 +205,180 @@ SYCLBLAS_DEFINE_BINARY_OPERATOR(
         ? static_cast<typename StripASP<rhs_t>::type>(r)
         : static_cast<typename StripASP<lhs_t>::type>(l))
 
+/*!
+ScaledSumSqOperator.
+@brief Reduction operator for the euclidean norm that accumulates a scaled sum
+of squares (LAPACK lassq) instead of the plain squares, so that neither large
+nor tiny magnitudes overflow or underflow.
+Each element x is lifted to the pair (|x|, 1), two partial results are merged
+by rescaling to the larger scale, and the last stage of the reduction writes
+scale * sqrt(ssq) to the output.
+*/
+struct ScaledSumSqOperator : public Operators {
+  template <typename value_t>
+  using accumulator_t = ScaledSumSqTuple<value_t>;
+
+  template <typename rhs_t>
+  static SYCL_BLAS_INLINE ScaledSumSqTuple<typename StripASP<rhs_t>::type>
+  lift(const rhs_t &r) {
+    using value_t = typename StripASP<rhs_t>::type;
+    return ScaledSumSqTuple<value_t>(
+        AbsoluteValue::eval(static_cast<value_t>(r)),
+        constant<value_t, const_val::one>::value());
+  }
+
+  template <typename lhs_t, typename rhs_t>
+  static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(
+      const lhs_t &_l, const rhs_t &_r) {
+    using tuple_t = typename StripASP<rhs_t>::type;
+    using value_t = typename tuple_t::value_t;
+    const tuple_t l = static_cast<typename StripASP<lhs_t>::type>(_l);
+    const tuple_t r = static_cast<tuple_t>(_r);
+    if (l.get_scale() < r.get_scale()) {
+      const value_t ratio = l.get_scale() / r.get_scale();
+      return tuple_t(r.get_scale(), r.get_ssq() + l.get_ssq() * ratio * ratio);
+    } else if (l.get_scale() == constant<value_t, const_val::zero>::value()) {
+      // Both sides are zero
+      return l;
+    } else {
+      const value_t ratio = r.get_scale() / l.get_scale();
+      return tuple_t(l.get_scale(), l.get_ssq() + r.get_ssq() * ratio * ratio);
+    }
+  }
+
+  template <typename rhs_t>
+  constexpr static SYCL_BLAS_INLINE typename rhs_t::value_t init() {
+    return constant<typename rhs_t::value_t, const_val::zero>::value();
+  }
+
+  template <typename out_t, typename acc_t>
+  static SYCL_BLAS_INLINE out_t finalise(const acc_t &acc) {
+    return acc.get_scale() * cl::sycl::sqrt(acc.get_ssq());
+  }
+};
+
+/*!
+CompensatedAddOperator.
+@brief Addition operator for reductions that carries the rounding error of each
+addition next to the sum (Neumaier's variant of Kahan summation), so that the
+error of a long sum does not grow with its length.
+Each element x is lifted to the pair (x, 0) and the last stage of the reduction
+writes sum + comp to the output. The compensation only survives if the kernels
+are not compiled with relaxed floating point math.
+*/
+struct CompensatedAddOperator : public Operators {
+  template <typename value_t>
+  using accumulator_t = CompensatedSumTuple<value_t>;
+
+  template <typename rhs_t>
+  static SYCL_BLAS_INLINE CompensatedSumTuple<typename StripASP<rhs_t>::type>
+  lift(const rhs_t &r) {
+    using value_t = typename StripASP<rhs_t>::type;
+    return CompensatedSumTuple<value_t>(
+        static_cast<value_t>(r), constant<value_t, const_val::zero>::value());
+  }
+
+  template <typename lhs_t, typename rhs_t>
+  static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(
+      const lhs_t &_l, const rhs_t &_r) {
+    using tuple_t = typename StripASP<rhs_t>::type;
+    using value_t = typename tuple_t::value_t;
+    const tuple_t l = static_cast<typename StripASP<lhs_t>::type>(_l);
+    const tuple_t r = static_cast<tuple_t>(_r);
+    const value_t sum = l.get_sum() + r.get_sum();
+    // The rounding error is recovered from the operand of larger magnitude
+    const value_t err = (AbsoluteValue::eval(l.get_sum()) >=
+                         AbsoluteValue::eval(r.get_sum()))
+                            ? (l.get_sum() - sum) + r.get_sum()
+                            : (r.get_sum() - sum) + l.get_sum();
+    return tuple_t(sum, (l.get_comp() + r.get_comp()) + err);
+  }
+
+  template <typename rhs_t>
+  constexpr static SYCL_BLAS_INLINE typename rhs_t::value_t init() {
+    return constant<typename rhs_t::value_t, const_val::zero>::value();
+  }
+
+  template <typename out_t, typename acc_t>
+  static SYCL_BLAS_INLINE out_t finalise(const acc_t &acc) {
+    return static_cast<out_t>(acc.get_sum() + acc.get_comp());
+  }
+};
+
+/*!
+WideAccumulator.
+@brief Type WideAddOperator accumulates values of type value_t in. Float is
+accumulated in double when the library is built with double support, any
+other type is accumulated in itself.
+*/
+template <typename value_t>
+struct WideAccumulator {
+  using type = value_t;
+};
+
+#if DOUBLE_SUPPORT
+template <>
+struct WideAccumulator<float> {
+  using type = double;
+};
+#endif
+
+/*!
+WideAddOperator.
+@brief Addition operator for reductions that accumulates in a wider type than
+the elements (float in double), rounding back to the element type only when
+the last stage of the reduction writes the result.
+*/
+struct WideAddOperator : public Operators {
+  template <typename value_t>
+  using accumulator_t = typename WideAccumulator<value_t>::type;
+
+  template <typename rhs_t>
+  static SYCL_BLAS_INLINE
+      typename WideAccumulator<typename StripASP<rhs_t>::type>::type
+      lift(const rhs_t &r) {
+    using acc_t =
+        typename WideAccumulator<typename StripASP<rhs_t>::type>::type;
+    return static_cast<acc_t>(r);
+  }
+
+  template <typename lhs_t, typename rhs_t>
+  static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(const lhs_t &l,
+                                                              const rhs_t &r) {
+    return l + r;
+  }
+
+  template <typename rhs_t>
+  constexpr static SYCL_BLAS_INLINE typename rhs_t::value_t init() {
+    return constant<typename rhs_t::value_t, const_val::zero>::value();
+  }
+
+  template <typename out_t, typename acc_t>
+  static SYCL_BLAS_INLINE out_t finalise(const acc_t &acc) {
+    return static_cast<out_t>(acc);
+  }
+};
+
+/*!
+UserReduceOperator.
+@brief Adapts a user functor to the reduction engine. functor_t must be
+default constructible, combine two values with operator() and provide its
+identity element as a constexpr static member template identity<value_t>().
+*/
+template <typename functor_t>
+struct UserReduceOperator : public Operators {
+  template <typename lhs_t, typename rhs_t>
+  static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(const lhs_t &l,
+                                                              const rhs_t &r) {
+    return functor_t()(l, r);
+  }
+
+  template <typename rhs_t>
+  constexpr static SYCL_BLAS_INLINE typename rhs_t::value_t init() {
+    return functor_t::template identity<typename rhs_t::value_t>();
+  }
+};
+
 }  // namespace blas
 
 #endif  // BLAS_OPERATORS_HPP
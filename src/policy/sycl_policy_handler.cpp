@@ -40,6 +40,14 @@ namespace blas {
   template BufferIterator<element_t, codeplay_policy>                          \
   PolicyHandler<codeplay_policy>::get_buffer<element_t>(                       \
       BufferIterator<element_t, codeplay_policy> buff) const;                  \
+  template BufferIterator<element_t, codeplay_policy>                          \
+  PolicyHandler<codeplay_policy>::get_host_buffer<element_t>(                  \
+      element_t * ptr, size_t size) const;                                     \
+  template BufferIterator<element_t, codeplay_policy>                          \
+  PolicyHandler<codeplay_policy>::get_host_buffer<element_t>(                  \
+      const element_t *ptr, size_t size) const;                                \
+  template bool PolicyHandler<codeplay_policy>::is_zero_copy<element_t>(       \
+      const element_t *ptr) const;                                             \
   template typename codeplay_policy::default_accessor_t<                       \
       typename ValueType<element_t>::type, cl::sycl::access::mode::read_write> \
       PolicyHandler<codeplay_policy>::get_range_access<                        \
@@ -32,13 +32,86 @@ namespace blas {
 template <typename element_t>
 inline element_t *PolicyHandler<codeplay_policy>::allocate(
     size_t num_elements) const {
-  return static_cast<element_t *>(cl::sycl::codeplay::SYCLmalloc(
-      num_elements * sizeof(element_t), *pointerMapperPtr_));
+  return static_cast<element_t *>(
+      allocate_bytes(num_elements * sizeof(element_t)));
 }
 
 template <typename element_t>
 inline void PolicyHandler<codeplay_policy>::deallocate(element_t *p) const {
-  cl::sycl::codeplay::SYCLfree(static_cast<void *>(p), *pointerMapperPtr_);
+  deallocate_bytes(static_cast<void *>(p));
+}
+
+inline size_t PolicyHandler<codeplay_policy>::get_bin_size(size_t bytes) {
+  size_t bin = 256;
+  while (bin < bytes) {
+    bin <<= 1;
+  }
+  return bin;
+}
+
+inline void *PolicyHandler<codeplay_policy>::allocate_bytes(
+    size_t bytes) const {
+  std::lock_guard<std::mutex> lock(cache_->mutex);
+  if (!cache_->enabled) {
+    return cl::sycl::codeplay::SYCLmalloc(bytes, *pointerMapperPtr_);
+  }
+  const size_t bin = get_bin_size(bytes);
+  void *p = nullptr;
+  auto &blocks = cache_->free_blocks[bin];
+  if (blocks.empty()) {
+    p = cl::sycl::codeplay::SYCLmalloc(bin, *pointerMapperPtr_);
+    cache_->stats.misses++;
+  } else {
+    p = blocks.back();
+    blocks.pop_back();
+    cache_->stats.hits++;
+    cache_->stats.bytes_cached -= bin;
+  }
+  cache_->live_blocks[p] = bin;
+  return p;
+}
+
+inline void PolicyHandler<codeplay_policy>::deallocate_bytes(void *p) const {
+  std::lock_guard<std::mutex> lock(cache_->mutex);
+  auto it = cache_->live_blocks.find(p);
+  if (it == cache_->live_blocks.end()) {
+    free_block(p);
+    return;
+  }
+  const size_t bin = it->second;
+  cache_->live_blocks.erase(it);
+  if (cache_->enabled) {
+    // The buffer tracks the kernels still using it, so it can be handed out
+    // again straight away
+    cache_->free_blocks[bin].push_back(p);
+    cache_->stats.bytes_cached += bin;
+  } else {
+    free_block(p);
+  }
+}
+
+inline cl::sycl::codeplay::PointerMapper::buffer_t
+PolicyHandler<codeplay_policy>::lookup_pointer(const void *ptr,
+                                               size_t &byteOffset) const {
+  const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+  std::lock_guard<std::mutex> lock(lookup_->mutex);
+  for (const auto &entry : lookup_->entries) {
+    if (address >= entry.base && address - entry.base < entry.bytes) {
+      byteOffset = address - entry.base;
+      return entry.buffer;
+    }
+  }
+  auto buffer = pointerMapperPtr_->get_buffer(const_cast<void *>(ptr));
+  byteOffset = pointerMapperPtr_->get_offset(ptr);
+  PointerLookupCache::Entry entry{address - byteOffset, buffer.get_count(),
+                                  buffer};
+  if (lookup_->entries.size() < PointerLookupCache::max_entries) {
+    lookup_->entries.push_back(entry);
+  } else {
+    lookup_->entries[lookup_->next] = entry;
+    lookup_->next = (lookup_->next + 1) % PointerLookupCache::max_entries;
+  }
+  return buffer;
 }
 
 /*
@@ -51,13 +124,13 @@ host side buffer<element_t> and element_t are the same
 template <typename element_t>
 inline BufferIterator<element_t, codeplay_policy>
 PolicyHandler<codeplay_policy>::get_buffer(element_t *ptr) const {
-  using pointer_t = typename std::remove_const<element_t>::type *;
-  auto original_buffer = pointerMapperPtr_->get_buffer(
-      static_cast<void *>(const_cast<pointer_t>(ptr)));
+  size_t byteOffset = 0;
+  auto original_buffer =
+      lookup_pointer(static_cast<const void *>(ptr), byteOffset);
   auto typed_size = original_buffer.get_count() / sizeof(element_t);
   auto buff =
       original_buffer.reinterpret<element_t>(cl::sycl::range<1>(typed_size));
-  auto offset = get_offset(ptr);
+  auto offset = static_cast<std::ptrdiff_t>(byteOffset / sizeof(element_t));
 
   return BufferIterator<element_t, codeplay_policy>(buff, offset);
 }
@@ -76,6 +149,44 @@ PolicyHandler<codeplay_policy>::get_buffer(
   return buff;
 }
 
+/*
+@brief this function wraps caller-owned host memory in a buffer, in place when
+the device shares the host memory
+@tparam element_t is the type of the data
+*/
+template <typename element_t>
+inline BufferIterator<element_t, codeplay_policy>
+PolicyHandler<codeplay_policy>::get_host_buffer(element_t *ptr,
+                                                size_t size) const {
+  using buff_t = typename codeplay_policy::buffer_t<element_t, 1>;
+  auto props = is_zero_copy(ptr)
+                   ? cl::sycl::property_list{cl::sycl::property::buffer::
+                                                 use_host_ptr()}
+                   : cl::sycl::property_list{};
+  return BufferIterator<element_t, codeplay_policy>{
+      buff_t{ptr, cl::sycl::range<1>(size), props}};
+}
+
+template <typename element_t>
+inline BufferIterator<element_t, codeplay_policy>
+PolicyHandler<codeplay_policy>::get_host_buffer(const element_t *ptr,
+                                                size_t size) const {
+  using buff_t = typename codeplay_policy::buffer_t<element_t, 1>;
+  auto props = is_zero_copy(ptr)
+                   ? cl::sycl::property_list{cl::sycl::property::buffer::
+                                                 use_host_ptr()}
+                   : cl::sycl::property_list{};
+  return BufferIterator<element_t, codeplay_policy>{
+      buff_t{ptr, cl::sycl::range<1>(size), props}};
+}
+
+template <typename element_t>
+inline bool PolicyHandler<codeplay_policy>::is_zero_copy(
+    const element_t *ptr) const {
+  return hostUnifiedMemory_ &&
+         (reinterpret_cast<std::uintptr_t>(ptr) % zeroCopyAlignment_ == 0);
+}
+
 /*  @brief Getting range accessor from the buffer created by virtual pointer
     @tparam element_t is the type of the data
     @tparam acc_md_t is the access mode
@@ -113,8 +224,9 @@ PolicyHandler<codeplay_policy>::get_range_access(
 template <typename element_t>
 inline std::ptrdiff_t PolicyHandler<codeplay_policy>::get_offset(
     const element_t *ptr) const {
-  return (pointerMapperPtr_->get_offset(static_cast<const void *>(ptr)) /
-          sizeof(element_t));
+  size_t byteOffset = 0;
+  lookup_pointer(static_cast<const void *>(ptr), byteOffset);
+  return byteOffset / sizeof(element_t);
 }
 /*
 @brief this function is to get the offset from the actual pointer
@@ -151,12 +263,13 @@ inline typename codeplay_policy::event_t
 PolicyHandler<codeplay_policy>::copy_to_device(
     const element_t *src, BufferIterator<element_t, codeplay_policy> dst,
     size_t size) {
+  flush_deferred();
   auto event = q_.submit([&](cl::sycl::handler &cgh) {
     auto acc =
         blas::get_range_accessor<cl::sycl::access::mode::write>(dst, cgh, size);
     cgh.copy(src, acc);
   });
-  return {event};
+  return {track_event(event)};
 }
 
 /*  @brief Copying the data back to device
@@ -183,12 +296,32 @@ inline typename codeplay_policy::event_t
 PolicyHandler<codeplay_policy>::copy_to_host(
     BufferIterator<element_t, codeplay_policy> src, element_t *dst,
     size_t size) {
+  flush_deferred();
   auto event = q_.submit([&](cl::sycl::handler &cgh) {
     auto acc =
         blas::get_range_accessor<cl::sycl::access::mode::read>(src, cgh, size);
     cgh.copy(acc, dst);
   });
-  return {event};
+  return {track_event(event)};
+}
+
+/*  @brief Setting the data on the device to a value
+    @tparam element_t is the type of the data
+    @param dst is the BufferIterator we want to fill.
+    @param value is the value every element is set to.
+    @param size is the number of elements to be set
+*/
+template <typename element_t>
+inline typename codeplay_policy::event_t PolicyHandler<codeplay_policy>::fill(
+    BufferIterator<element_t, codeplay_policy> dst, element_t value,
+    size_t size) {
+  flush_deferred();
+  auto event = q_.submit([&](cl::sycl::handler &cgh) {
+    auto acc =
+        blas::get_range_accessor<cl::sycl::access::mode::write>(dst, cgh, size);
+    cgh.fill(acc, value);
+  });
+  return {track_event(event)};
 }
 }  // namespace blas
 #endif  // QUEUE_SYCL_HPP
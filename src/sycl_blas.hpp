@@ -28,6 +28,8 @@
 
 #include "executors/executor_sycl.hpp"
 
+#include "executors/executor_usm.hpp"
+
 #include "executors/kernel_constructor.hpp"
 
 #include "interface/blas1_interface.hpp"
@@ -36,6 +38,10 @@
 
 #include "interface/blas3_interface.hpp"
 
+#include "interface/deferred_interface.hpp"
+
+#include "interface/generic_interface.hpp"
+
 #include "interface/gemm_launcher.hpp"
 
 #include "operations/blas1_trees.hpp"
@@ -51,3 +57,5 @@
 #include "policy/sycl_policy_handler.hpp"
 
 #include "views/view_sycl.hpp"
+
+#include "views/view_usm.hpp"
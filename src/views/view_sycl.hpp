@@ -243,6 +243,27 @@ struct VectorView<
     return eval(ndItem.get_global_id(0));
   }
 
+  /*!
+   * @brief Loads width consecutive elements starting at the element i.
+   * Only valid when the view has unit stride.
+   */
+  template <int width>
+  SYCL_BLAS_INLINE cl::sycl::vec<scalar_t, width> eval_vec(index_t i) {
+    cl::sycl::vec<scalar_t, width> val;
+    val.load(0, data_.get_pointer() + disp_ + i);
+    return val;
+  }
+
+  /*!
+   * @brief Stores width consecutive elements starting at the element i.
+   * Only valid when the view has unit stride.
+   */
+  template <int width>
+  SYCL_BLAS_INLINE void store_vec(index_t i,
+                                  const cl::sycl::vec<scalar_t, width> &val) {
+    val.store(0, data_.get_pointer() + disp_ + i);
+  }
+
   /**** PRINTING ****/
   template <class X, class Y, typename IndxT, typename IncrT>
   friend std::ostream &operator<<(std::ostream &stream,
@@ -263,6 +284,55 @@ struct VectorView<
 
   SYCL_BLAS_INLINE void bind(cl::sycl::handler &h) { h.require(data_); }
 };
+
+/*!
+ * @brief See BatchedVectorView.
+ */
+template <typename view_t>
+struct BatchedVectorView {
+  using value_t = typename view_t::value_t;
+  using index_t = typename view_t::index_t;
+  using increment_t = typename view_t::increment_t;
+  view_t data_;
+  index_t vector_size_;
+  increment_t inc_;
+  index_t stride_;
+  index_t batch_size_;
+
+  SYCL_BLAS_INLINE BatchedVectorView(view_t data, index_t vector_size,
+                                     increment_t inc, index_t stride,
+                                     index_t batch_size)
+      : data_(data),
+        vector_size_(vector_size),
+        inc_(inc),
+        stride_(stride),
+        batch_size_(batch_size) {}
+
+  SYCL_BLAS_INLINE index_t get_size() const {
+    return vector_size_ * batch_size_;
+  }
+
+  SYCL_BLAS_INLINE index_t get_vector_size() const { return vector_size_; }
+
+  SYCL_BLAS_INLINE index_t get_batch_size() const { return batch_size_; }
+
+  SYCL_BLAS_INLINE value_t &eval(index_t i) {
+    const index_t batch = i / vector_size_;
+    const index_t j = i - batch * vector_size_;
+    // As in BLAS, a negative increment walks the vector backwards
+    const index_t ind = batch * stride_ + ((inc_ > 0)
+                                               ? j * inc_
+                                               : (j - vector_size_ + 1) * inc_);
+    return data_.eval(ind);
+  }
+
+  SYCL_BLAS_INLINE value_t &eval(cl::sycl::nd_item<1> ndItem) {
+    return eval(ndItem.get_global_id(0));
+  }
+
+  SYCL_BLAS_INLINE void bind(cl::sycl::handler &h) { data_.bind(h); }
+};
+
 template <class ViewScalarT, typename view_index_t>
 struct MatrixView<
     ViewScalarT,
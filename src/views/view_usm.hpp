@@ -0,0 +1,263 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename view_usm.hpp
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_VIEW_USM_HPP
+#define SYCL_BLAS_VIEW_USM_HPP
+
+#ifdef SYCL_BLAS_USE_USM
+
+#include <CL/sycl.hpp>
+
+#include "blas_meta.h"
+#include "types/access_types.h"
+#include "views/view.h"
+#include "views/view_usm.h"
+
+namespace blas {
+
+/*!
+ * @brief View of a vector held in a USM device allocation.
+ * The pointer is captured by value in the kernel, so the view does not bind
+ * anything to the command group. As in BLAS, the pointer is the lowest
+ * address of the vector whatever the sign of the stride.
+ * @tparam scalar_t Value type of the allocation.
+ */
+template <typename ViewScalarT, typename view_index_t,
+          typename view_increment_t>
+struct VectorView<ViewScalarT, ViewScalarT *, view_index_t, view_increment_t> {
+  using scalar_t = ViewScalarT;
+  using index_t = view_index_t;
+  using increment_t = view_increment_t;
+  using container_t = scalar_t *;
+  using self_t = VectorView<scalar_t, container_t, index_t, increment_t>;
+  container_t data_;
+  index_t size_data_;
+  index_t size_;
+  index_t disp_;
+  increment_t strd_;  // never size_t, because it could negative
+
+  using value_t = scalar_t;
+
+  /*!
+   * @brief See VectorView.
+   */
+  SYCL_BLAS_INLINE VectorView(container_t data, increment_t strd,
+                              index_t size)
+      : VectorView(data, 0, strd, size) {}
+
+  /*!
+   * @brief See VectorView.
+   */
+  SYCL_BLAS_INLINE VectorView(container_t data, index_t disp, increment_t strd,
+                              index_t size)
+      : data_{data},
+        size_data_(disp + (size - 1) * ((strd < 0) ? -strd : strd) + 1),
+        size_(size),
+        disp_(disp),
+        strd_(strd) {
+#ifndef __SYCL_DEVICE_ONLY__
+    if (strd_ == 0) {
+      throw std::invalid_argument("Cannot create view with 0 stride");
+    }
+#endif  //__SYCL_DEVICE_ONLY__
+  }
+
+  /*!
+   * @brief See VectorView.
+   */
+  SYCL_BLAS_INLINE container_t &get_data() { return data_; }
+
+  /*!
+   * @brief See VectorView.
+   */
+  SYCL_BLAS_INLINE index_t get_data_size() const { return size_data_; }
+
+  /*!
+   * @brief See VectorView.
+   */
+  SYCL_BLAS_INLINE index_t get_size() const { return size_; }
+
+  /*!
+   * @brief See VectorView.
+   */
+  SYCL_BLAS_INLINE index_t get_access_displacement() const { return disp_; }
+
+  /*!
+   * @brief See VectorView.
+   */
+  SYCL_BLAS_INLINE increment_t get_stride() const { return strd_; }
+
+  /*!
+   * @brief See VectorView.
+   */
+  SYCL_BLAS_INLINE self_t operator+(index_t disp) {
+    if (this->strd_ > 0)
+      return self_t(this->data_, this->disp_ + (disp * this->strd_),
+                    this->strd_, this->size_ - disp);
+    else
+      return self_t(this->data_, this->disp_, this->strd_, this->size_ - disp);
+  }
+
+  /**** EVALUATING ****/
+  SYCL_BLAS_INLINE scalar_t &eval(index_t i) {
+    auto ind = disp_;
+    if (strd_ == 1) {
+      ind += i;
+    } else if (strd_ > 0) {
+      ind += strd_ * i;
+    } else {
+      ind -= strd_ * (size_ - i - 1);
+    }
+    return data_[ind];
+  }
+
+  SYCL_BLAS_INLINE scalar_t &eval(cl::sycl::nd_item<1> ndItem) {
+    return eval(ndItem.get_global_id(0));
+  }
+
+  /*!
+   * @brief Loads width consecutive elements starting at the element i.
+   * Only valid when the view has unit stride.
+   */
+  template <int width>
+  SYCL_BLAS_INLINE cl::sycl::vec<scalar_t, width> eval_vec(index_t i) {
+    cl::sycl::vec<scalar_t, width> val;
+    val.load(0, cl::sycl::global_ptr<scalar_t>(data_ + disp_ + i));
+    return val;
+  }
+
+  /*!
+   * @brief Stores width consecutive elements starting at the element i.
+   * Only valid when the view has unit stride.
+   */
+  template <int width>
+  SYCL_BLAS_INLINE void store_vec(index_t i,
+                                  const cl::sycl::vec<scalar_t, width> &val) {
+    val.store(0, cl::sycl::global_ptr<scalar_t>(data_ + disp_ + i));
+  }
+
+  SYCL_BLAS_INLINE void bind(cl::sycl::handler &h) {}
+};
+
+/*!
+ * @brief View of a column-major matrix held in a USM device allocation.
+ */
+template <class ViewScalarT, typename view_index_t>
+struct MatrixView<ViewScalarT, ViewScalarT *, view_index_t> {
+  using scalar_t = ViewScalarT;
+  using index_t = view_index_t;
+  using container_t = scalar_t *;
+  using self_t = MatrixView<scalar_t, container_t, index_t>;
+  container_t data_;
+
+  Access deviceAccess_;
+  Access operationAccess_;
+  Access overallAccess_;
+
+  index_t sizeR_;  // number of rows
+  index_t sizeC_;  // number of columns
+  index_t sizeL_;  // size of the leading dimension
+  index_t disp_;   // displacement of the first element
+  using value_t = scalar_t;
+
+  /**** CONSTRUCTORS ****/
+
+  SYCL_BLAS_INLINE MatrixView(container_t data, index_t sizeR, index_t sizeC,
+                              Access accessOpr, index_t sizeL,
+                              index_t disp = 0)
+      : data_{data},
+        deviceAccess_(Access::col_major()),
+        operationAccess_(accessOpr),
+        overallAccess_(deviceAccess_, operationAccess_),
+        sizeR_(sizeR),
+        sizeC_(sizeC),
+        sizeL_(sizeL),
+        disp_(disp) {}
+
+  /**** RETRIEVING DATA ****/
+  SYCL_BLAS_INLINE container_t &get_data() { return data_; }
+
+  SYCL_BLAS_INLINE index_t get_data_size() const {
+    return disp_ + sizeL_ * ((overallAccess_.is_row_major()) ? sizeR_ : sizeC_);
+  }
+
+  SYCL_BLAS_INLINE index_t get_size() const { return sizeR_ * sizeC_; }
+
+  SYCL_BLAS_INLINE index_t getSizeL() const { return sizeL_; }
+
+  SYCL_BLAS_INLINE index_t get_size_row() const { return sizeR_; }
+
+  SYCL_BLAS_INLINE index_t get_size_col() const { return sizeC_; }
+
+  SYCL_BLAS_INLINE bool is_row_access() const {
+    return overallAccess_.is_row_major();
+  }
+
+  SYCL_BLAS_INLINE Access get_access_device() const { return deviceAccess_; }
+
+  SYCL_BLAS_INLINE Access get_access_operation() const {
+    return operationAccess_;
+  }
+
+  SYCL_BLAS_INLINE index_t get_access_displacement() const { return disp_; }
+
+  /**** OPERATORS ****/
+  SYCL_BLAS_INLINE self_t operator+(index_t disp) {
+    return self_t(this->data_, this->sizeR_, this->sizeC_,
+                  this->operationAccess_, this->sizeL_, this->disp_ + disp);
+  }
+
+  /**** EVALUATING ***/
+  SYCL_BLAS_INLINE scalar_t &eval(index_t k) {
+    bool access = overallAccess_.is_row_major();
+    auto size = (access) ? sizeC_ : sizeR_;
+    auto i = (access) ? (k / size) : (k % size);
+    auto j = (access) ? (k % size) : (k / size);
+
+    return eval(i, j);
+  }
+
+  SYCL_BLAS_INLINE scalar_t &eval(index_t i, index_t j) {
+    auto ind = disp_;
+
+    if (overallAccess_.is_row_major()) {
+      ind += (sizeL_ * i) + j;
+    } else {
+      ind += (sizeL_ * j) + i;
+    }
+    return data_[ind];
+  }
+
+  SYCL_BLAS_INLINE scalar_t &eval(cl::sycl::nd_item<1> ndItem) {
+    return eval(ndItem.get_global_id(0));
+  }
+
+  SYCL_BLAS_INLINE void bind(cl::sycl::handler &h) {}
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_USE_USM
+
+#endif  // SYCL_BLAS_VIEW_USM_HPP
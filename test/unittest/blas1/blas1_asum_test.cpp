@@ -25,13 +25,14 @@
 
 #include "blas_test.hpp"
 
-using combination_t = std::tuple<int, int>;
+using combination_t = std::tuple<int, int, blas::Accuracy>;
 
 template <typename scalar_t>
 void run_test(const combination_t combi) {
   int size;
   int incX;
-  std::tie(size, incX) = combi;
+  blas::Accuracy accuracy;
+  std::tie(size, incX, accuracy) = combi;
 
   // Input vector
   std::vector<scalar_t> x_v(size * incX);
@@ -53,7 +54,7 @@ void run_test(const combination_t combi) {
   auto gpu_out_s = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
   ex.get_policy_handler().copy_to_device(out_s.data(), gpu_out_s, 1);
 
-  _asum(ex, size, gpu_x_v, incX, gpu_out_s);
+  _asum(ex, size, gpu_x_v, incX, gpu_out_s, accuracy);
   auto event = ex.get_policy_handler().copy_to_host(gpu_out_s, out_s.data(), 1);
   ex.get_policy_handler().wait(event);
 
@@ -63,7 +64,11 @@ void run_test(const combination_t combi) {
 
 const auto combi =
     ::testing::Combine(::testing::Values(11, 65, 10000, 1002400),  // size
-                       ::testing::Values(1, 4)                     // incX
+                       ::testing::Values(1, 4),                    // incX
+                       ::testing::Values(blas::Accuracy::standard,
+                                         blas::Accuracy::compensated,
+                                         blas::Accuracy::pairwise,
+                                         blas::Accuracy::wide)  // accuracy
     );
 
 class AsumFloat : public ::testing::TestWithParam<combination_t> {};
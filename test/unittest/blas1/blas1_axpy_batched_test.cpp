@@ -0,0 +1,106 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_axpy_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, scalar_t, int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  int incX;
+  int incY;
+  int gap;
+  int batch_size;
+  std::tie(size, alpha, incX, incY, gap, batch_size) = combi;
+  const int strideX = size * incX + gap;
+  const int strideY = size * incY + gap;
+
+  // Input vectors
+  std::vector<scalar_t> x_v(strideX * batch_size);
+  fill_random(x_v);
+
+  // Output vectors
+  std::vector<scalar_t> y_v(strideY * batch_size, 10.0);
+  std::vector<scalar_t> y_cpu_v(strideY * batch_size, 10.0);
+
+  // Reference implementation
+  for (int b = 0; b < batch_size; ++b) {
+    reference_blas::axpy(size, alpha, x_v.data() + b * strideX, incX,
+                         y_cpu_v.data() + b * strideY, incY);
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(x_v.size()));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, x_v.size());
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(y_v.size()));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, y_v.size());
+
+  _axpy_batched(ex, size, alpha, gpu_x_v, incX, strideX, gpu_y_v, incY,
+                strideY, batch_size);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(), y_v.size());
+  ex.get_policy_handler().wait(event);
+
+  // Validate the result, the gaps between the vectors must be untouched
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(1, 11, 65, 1002),  // size
+                       ::testing::Values(0.0, 1.5),         // alpha
+                       ::testing::Values(1, 4),             // incX
+                       ::testing::Values(1, 3),             // incY
+                       ::testing::Values(0, 5),             // gap
+                       ::testing::Values(1, 7, 513)         // batch_size
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 65),  // size
+                                      ::testing::Values(1.5),     // alpha
+                                      ::testing::Values(1, 4),    // incX
+                                      ::testing::Values(1, 3),    // incY
+                                      ::testing::Values(0, 5),    // gap
+                                      ::testing::Values(1, 7)     // batch_size
+);
+#endif
+
+class AxpyBatchedFloat
+    : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(AxpyBatchedFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(axpy_batched, AxpyBatchedFloat, combi);
+
+#if DOUBLE_SUPPORT
+class AxpyBatchedDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(AxpyBatchedDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(axpy_batched, AxpyBatchedDouble, combi);
+#endif
@@ -0,0 +1,143 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_axpy_dependencies_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, scalar_t, scalar_t>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  scalar_t beta;
+  std::tie(size, alpha, beta) = combi;
+
+  // Input vector
+  std::vector<scalar_t> x_v(2 * size);
+  fill_random(x_v);
+
+  // Output vector
+  std::vector<scalar_t> y_v(2 * size, 10.0);
+  std::vector<scalar_t> y_cpu_v(2 * size, 10.0);
+
+  // Reference implementation
+  reference_blas::axpy(2 * size, alpha, x_v.data(), 1, y_cpu_v.data(), 1);
+  reference_blas::scal(2 * size, beta, y_cpu_v.data(), 1);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(2 * size);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(2 * size);
+  auto copies = blas::concatenate_vectors(
+      policy_handler.copy_to_device(x_v.data(), gpu_x_v, 2 * size),
+      policy_handler.copy_to_device(y_v.data(), gpu_y_v, 2 * size));
+
+  // Each half only depends on the copies, the scaling on both halves
+  auto first = _axpy(ex, size, alpha, gpu_x_v, 1, gpu_y_v, 1, copies);
+  auto second =
+      _axpy(ex, size, alpha, gpu_x_v + size, 1, gpu_y_v + size, 1, copies);
+  _scal(ex, 2 * size, beta, gpu_y_v, 1,
+        blas::concatenate_vectors(first, second));
+  auto event = policy_handler.copy_to_host(gpu_y_v, y_v.data(), 2 * size);
+  policy_handler.wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+template <typename scalar_t>
+void run_nonblocking_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  scalar_t beta;
+  std::tie(size, alpha, beta) = combi;
+
+  // Input vector
+  std::vector<scalar_t> x_v(size);
+  fill_random(x_v);
+
+  // Output vector
+  std::vector<scalar_t> y_v(size, 10.0);
+  std::vector<scalar_t> y_cpu_v(size, 10.0);
+
+  // Reference implementation
+  reference_blas::axpy(size, alpha, x_v.data(), 1, y_cpu_v.data(), 1);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(size);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(size);
+  policy_handler.wait(
+      policy_handler.copy_to_device(y_v.data(), gpu_y_v, size));
+
+  typename blas::codeplay_policy::event_t copy;
+  {
+    // The copy of x cannot start while the host holds its buffer
+    auto host_x = gpu_x_v.get_buffer()
+                      .template get_access<cl::sycl::access::mode::write>();
+    copy = policy_handler.copy_to_device(x_v.data(), gpu_x_v, size);
+    _axpy(ex, size, alpha, gpu_x_v, 1, gpu_y_v, 1, copy);
+    // The call has returned without waiting for its dependency
+    ASSERT_NE(copy[0].template get_info<
+                  cl::sycl::info::event::command_execution_status>(),
+              cl::sycl::info::event_command_status::complete);
+  }
+  auto event = policy_handler.copy_to_host(gpu_y_v, y_v.data(), size);
+  policy_handler.wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(0.0, 1.5),  // alpha
+                                      ::testing::Values(2.0)        // beta
+);
+
+class AxpyDependenciesFloat
+    : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(AxpyDependenciesFloat, test) { run_test<float>(GetParam()); };
+TEST_P(AxpyDependenciesFloat, nonblocking) {
+  run_nonblocking_test<float>(GetParam());
+};
+INSTANTIATE_TEST_SUITE_P(axpy_dependencies, AxpyDependenciesFloat, combi);
+
+#if DOUBLE_SUPPORT
+class AxpyDependenciesDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(AxpyDependenciesDouble, test) { run_test<double>(GetParam()); };
+TEST_P(AxpyDependenciesDouble, nonblocking) {
+  run_nonblocking_test<double>(GetParam());
+};
+INSTANTIATE_TEST_SUITE_P(axpy_dependencies, AxpyDependenciesDouble, combi);
+#endif
@@ -0,0 +1,135 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_chunked_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+// Elements evaluated by a work item in each iteration of the chunked kernels
+constexpr int chunk_size = 4;
+
+// The number of times the largest grid is covered, the number of elements
+// after the last full grid, and the increments
+using combination_t = std::tuple<int, int, int, int>;
+
+// The largest grid of the chunked kernels, 16 work groups per compute unit,
+// times the elements each work item evaluates per iteration
+inline int grid_elements(test_executor_t &ex) {
+  auto policy_handler = ex.get_policy_handler();
+  return static_cast<int>(16 * policy_handler.get_num_compute_units() *
+                          policy_handler.get_work_group_size() * chunk_size);
+}
+
+template <typename scalar_t>
+void run_axpy_test(const combination_t combi) {
+  int grids;
+  int tail;
+  int incX;
+  int incY;
+  std::tie(grids, tail, incX, incY) = combi;
+  const scalar_t alpha(1.5);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  const int size = grids * grid_elements(ex) + tail;
+
+  // Input vector
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+
+  // Output vector
+  std::vector<scalar_t> y_v(size * incY);
+  fill_random(y_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+
+  // Reference implementation
+  reference_blas::axpy(size, alpha, x_v.data(), incX, y_cpu_v.data(), incY);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+
+  _axpy(ex, size, alpha, gpu_x_v, incX, gpu_y_v, incY);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(), size * incY);
+  ex.get_policy_handler().wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+template <typename scalar_t>
+void run_scal_test(const combination_t combi) {
+  int grids;
+  int tail;
+  int incX;
+  std::tie(grids, tail, incX, std::ignore) = combi;
+  const scalar_t alpha(1.5);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  const int size = grids * grid_elements(ex) + tail;
+
+  // Input/output vector
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+
+  // Reference implementation
+  reference_blas::scal(size, alpha, x_cpu_v.data(), incX);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+
+  _scal(ex, size, alpha, gpu_x_v, incX);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_x_v, x_v.data(), size * incX);
+  ex.get_policy_handler().wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+}
+
+// With one grid and a tail, the strided kernel needs a second iteration of
+// its grid-stride loop. With three grids both kernels do. A tail of 6 holds
+// one full chunk and two single elements.
+const auto combi = ::testing::Combine(::testing::Values(1, 3),        // grids
+                                      ::testing::Values(0, 1, 3, 6),  // tail
+                                      ::testing::Values(1, 2),        // incX
+                                      ::testing::Values(1, 3)         // incY
+);
+
+class ChunkedFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(ChunkedFloat, axpy) { run_axpy_test<float>(GetParam()); };
+TEST_P(ChunkedFloat, scal) { run_scal_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(chunked, ChunkedFloat, combi);
+
+#if DOUBLE_SUPPORT
+class ChunkedDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(ChunkedDouble, axpy) { run_axpy_test<double>(GetParam()); };
+TEST_P(ChunkedDouble, scal) { run_scal_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(chunked, ChunkedDouble, combi);
+#endif
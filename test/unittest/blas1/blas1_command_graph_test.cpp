@@ -0,0 +1,103 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_command_graph_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  int replays;
+  std::tie(size, replays) = combi;
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+
+  // Buffers the graph is recorded with
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(size);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(size);
+  auto gpu_out_s = blas::make_sycl_iterator_buffer<scalar_t>(1);
+
+  // y = beta * (alpha * x + y), out = x . y
+  auto graph = blas::make_command_graph(ex);
+  auto alpha = graph.make_scalar(scalar_t(0));
+  auto beta = graph.make_scalar(scalar_t(0));
+  graph.record([&]() {
+    _axpy(ex, size, alpha, gpu_x_v, 1, gpu_y_v, 1);
+    _scal(ex, size, beta, gpu_y_v, 1);
+    _dot(ex, size, gpu_x_v, 1, gpu_y_v, 1, gpu_out_s);
+  });
+  ASSERT_GE(graph.get_num_kernels(), size_t(3));
+
+  for (int r = 0; r < replays; r++) {
+    std::vector<scalar_t> x_v(size);
+    fill_random(x_v);
+    std::vector<scalar_t> y_v(size);
+    fill_random(y_v);
+    const scalar_t alpha_s = scalar_t(1.5) + r;
+    const scalar_t beta_s = scalar_t(0.5) * (r + 1);
+
+    // Reference implementation
+    std::vector<scalar_t> y_cpu_v(y_v);
+    reference_blas::axpy(size, alpha_s, x_v.data(), 1, y_cpu_v.data(), 1);
+    reference_blas::scal(size, beta_s, y_cpu_v.data(), 1);
+    auto out_cpu_s =
+        reference_blas::dot(size, x_v.data(), 1, y_cpu_v.data(), 1);
+
+    // Bind the parameters and replay
+    auto gpu_new_x_v = blas::make_sycl_iterator_buffer<scalar_t>(size);
+    policy_handler.copy_to_device(x_v.data(), gpu_new_x_v, size);
+    graph.set_buffer(gpu_x_v, gpu_new_x_v, size);
+    policy_handler.copy_to_device(y_v.data(), gpu_y_v, size);
+    graph.set_scalar(alpha, alpha_s);
+    graph.set_scalar(beta, beta_s);
+    graph.replay();
+
+    std::vector<scalar_t> out_s(1);
+    auto event = policy_handler.copy_to_host(gpu_y_v, y_v.data(), size);
+    policy_handler.wait(event);
+    event = policy_handler.copy_to_host(gpu_out_s, out_s.data(), 1);
+    policy_handler.wait(event);
+
+    // Validate the result
+    ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+    ASSERT_TRUE(utils::almost_equal(out_s[0], out_cpu_s));
+  }
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 3)       // replays
+);
+
+class CommandGraphFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(CommandGraphFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(command_graph, CommandGraphFloat, combi);
+
+#if DOUBLE_SUPPORT
+class CommandGraphDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(CommandGraphDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(command_graph, CommandGraphDouble, combi);
+#endif
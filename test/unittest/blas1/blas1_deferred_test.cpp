@@ -0,0 +1,134 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_deferred_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, scalar_t, int, bool>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  int incX;
+  bool fusable;
+  std::tie(size, alpha, incX, fusable) = combi;
+  // Reading y with a different increment than the one it is written with
+  // makes the chain impossible to fuse
+  const int incY = fusable ? incX : incX + 1;
+
+  // Input vectors
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> z_v(size * incY);
+  fill_random(z_v);
+
+  // Output vector
+  std::vector<scalar_t> y_v(size * incY, 10.0);
+  std::vector<scalar_t> y_cpu_v(size * incY, 10.0);
+  std::vector<scalar_t> z_cpu_v(z_v);
+
+  // Reference implementation, y = x; z = alpha * y + z; y = alpha * y
+  reference_blas::copy(size, x_v.data(), incX, y_cpu_v.data(), incX);
+  reference_blas::axpy(size, alpha, y_cpu_v.data(), incY, z_cpu_v.data(),
+                       incY);
+  reference_blas::scal(size, alpha, y_cpu_v.data(), incX);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+  auto gpu_z_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+  ex.get_policy_handler().copy_to_device(z_v.data(), gpu_z_v, size * incY);
+
+  // The calls are made as usual, the policy handler defers them
+  auto policy_handler = ex.get_policy_handler();
+  policy_handler.start_deferring();
+  _copy(ex, size, gpu_x_v, incX, gpu_y_v, incX);
+  _axpy(ex, size, alpha, gpu_y_v, incY, gpu_z_v, incY);
+  _scal(ex, size, alpha, gpu_y_v, incX);
+  // Copying the results back submits the deferred calls first
+  auto event0 = policy_handler.copy_to_host(gpu_y_v, y_v.data(), size * incY);
+  auto event1 = policy_handler.copy_to_host(gpu_z_v, z_v.data(), size * incY);
+  policy_handler.wait(event0, event1);
+
+  // A fused chain is a single kernel, as seen when recording it
+  auto graph = make_command_graph(ex);
+  graph.record([&]() {
+    _copy(ex, size, gpu_x_v, incX, gpu_y_v, incX);
+    _axpy(ex, size, alpha, gpu_y_v, incY, gpu_z_v, incY);
+    _scal(ex, size, alpha, gpu_y_v, incX);
+  });
+  policy_handler.stop_deferring();
+  ASSERT_EQ(graph.get_num_kernels(), fusable ? 1u : 3u);
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(z_v, z_cpu_v));
+
+  // The calls still deferred when the last copy of a handler is destroyed
+  // are submitted
+  reference_blas::scal(size, alpha, z_cpu_v.data(), incY);
+  {
+    test_executor_t ex2(q);
+    ex2.get_policy_handler().start_deferring();
+    _scal(ex2, size, alpha, gpu_z_v, incY);
+  }
+  auto event2 = policy_handler.copy_to_host(gpu_z_v, z_v.data(), size * incY);
+  policy_handler.wait(event2);
+  ASSERT_TRUE(utils::compare_vectors(z_v, z_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(0.0, 1.5),               // alpha
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(true, false)             // fusable
+    );
+#else
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1002),     // size
+                       ::testing::Values(1.5),          // alpha
+                       ::testing::Values(1, 4),         // incX
+                       ::testing::Values(true, false)   // fusable
+    );
+#endif
+
+class DeferredFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(DeferredFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(deferred, DeferredFloat, combi);
+
+#if DOUBLE_SUPPORT
+class DeferredDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(DeferredDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(deferred, DeferredDouble, combi);
+#endif
@@ -0,0 +1,180 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_dot_async_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, int, int>;
+using reduction_combination_t = std::tuple<int, int>;
+
+// Waits on the events returned with the scalar, then reads the value the
+// device wrote to its buffer
+template <typename element_t, typename policy_t>
+element_t wait_and_read(test_executor_t &ex,
+                        const blas::DeviceScalar<element_t, policy_t> &res) {
+  auto events = res.get_events();
+  EXPECT_FALSE(events.empty());
+  ex.get_policy_handler().wait(events);
+  for (auto &e : events) {
+    EXPECT_EQ(
+        e.template get_info<
+            cl::sycl::info::event::command_execution_status>(),
+        cl::sycl::info::event_command_status::complete);
+  }
+  element_t value{};
+  auto event = ex.get_policy_handler().copy_to_host(res.get_data(), &value, 1);
+  ex.get_policy_handler().wait(event);
+  return value;
+}
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  int incX;
+  int incY;
+  std::tie(size, incX, incY) = combi;
+
+  // Input vectors
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(size * incY);
+  fill_random(y_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+
+  // Reference implementation: y = dot(x, y) * x + y
+  auto dot_cpu_s =
+      reference_blas::dot(size, x_v.data(), incX, y_v.data(), incY);
+  reference_blas::axpy(size, dot_cpu_s, x_v.data(), incX, y_cpu_v.data(),
+                       incY);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+
+  // The dot product is consumed by axpy without reaching the host
+  auto dot_s = _dot_async(ex, size, gpu_x_v, incX, gpu_y_v, incY);
+  _axpy(ex, size, dot_s, gpu_x_v, incX, gpu_y_v, incY);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(), size * incY);
+  ex.get_policy_handler().wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::almost_equal(dot_s.get(ex), dot_cpu_s));
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+template <typename scalar_t>
+void run_reduction_test(const reduction_combination_t combi) {
+  using tuple_t = IndexValueTuple<scalar_t, int>;
+
+  int size;
+  int incX;
+  std::tie(size, incX) = combi;
+
+  // Input vector
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+
+  // Reference implementation
+  auto asum_cpu_s = reference_blas::asum(size, x_v.data(), incX);
+  auto nrm2_cpu_s = reference_blas::nrm2(size, x_v.data(), incX);
+  auto iamax_cpu_s = reference_blas::iamax(size, x_v.data(), incX);
+  auto iamin_cpu_s = reference_blas::iamin(size, x_v.data(), incX);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+
+  auto asum_s = _asum_async(ex, size, gpu_x_v, incX);
+  auto nrm2_s = _nrm2_async(ex, size, gpu_x_v, incX);
+  auto iamax_s = _iamax_async(ex, size, gpu_x_v, incX);
+  auto iamin_s = _iamin_async(ex, size, gpu_x_v, incX);
+
+  // Validate the result
+  ASSERT_TRUE(utils::almost_equal(wait_and_read(ex, asum_s), asum_cpu_s));
+  ASSERT_TRUE(utils::almost_equal(wait_and_read(ex, nrm2_s), nrm2_cpu_s));
+  tuple_t iamax_v = wait_and_read(ex, iamax_s);
+  ASSERT_EQ(iamax_cpu_s, iamax_v.ind);
+  tuple_t iamin_v = wait_and_read(ex, iamin_s);
+  ASSERT_EQ(iamin_cpu_s, iamin_v.ind);
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(1, 3)                    // incY
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 3)       // incY
+);
+#endif
+
+class DotAsyncFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(DotAsyncFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(dot_async, DotAsyncFloat, combi);
+
+#if DOUBLE_SUPPORT
+class DotAsyncDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(DotAsyncDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(dot_async, DotAsyncDouble, combi);
+#endif
+
+#ifdef STRESS_TESTING
+const auto reduction_combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4)                    // incX
+    );
+#else
+const auto reduction_combi =
+    ::testing::Combine(::testing::Values(11, 1002),  // size
+                       ::testing::Values(1, 4)       // incX
+    );
+#endif
+
+class ReductionAsyncFloat
+    : public ::testing::TestWithParam<reduction_combination_t> {};
+TEST_P(ReductionAsyncFloat, test) { run_reduction_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(reduction_async, ReductionAsyncFloat,
+                         reduction_combi);
+
+#if DOUBLE_SUPPORT
+class ReductionAsyncDouble
+    : public ::testing::TestWithParam<reduction_combination_t> {};
+TEST_P(ReductionAsyncDouble, test) { run_reduction_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(reduction_async, ReductionAsyncDouble,
+                         reduction_combi);
+#endif
@@ -0,0 +1,101 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_dot_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  int incX;
+  int incY;
+  int gap;
+  int batch_size;
+  std::tie(size, incX, incY, gap, batch_size) = combi;
+  const int strideX = size * incX + gap;
+  const int strideY = size * incY + gap;
+
+  // Input vectors
+  std::vector<scalar_t> x_v(strideX * batch_size);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(strideY * batch_size);
+  fill_random(y_v);
+
+  // Output vector
+  std::vector<scalar_t> out_v(batch_size, 10.0);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(x_v.size()));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, x_v.size());
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(y_v.size()));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, y_v.size());
+  auto gpu_out_v = blas::make_sycl_iterator_buffer<scalar_t>(batch_size);
+  ex.get_policy_handler().copy_to_device(out_v.data(), gpu_out_v, batch_size);
+
+  _dot_batched(ex, size, gpu_x_v, incX, strideX, gpu_y_v, incY, strideY,
+               gpu_out_v, batch_size);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_out_v, out_v.data(),
+                                                    batch_size);
+  ex.get_policy_handler().wait(event);
+
+  // Validate the result against the reference for every vector
+  for (int b = 0; b < batch_size; ++b) {
+    auto out_cpu_s = reference_blas::dot(size, x_v.data() + b * strideX, incX,
+                                         y_v.data() + b * strideY, incY);
+    ASSERT_TRUE(utils::almost_equal(out_v[b], out_cpu_s));
+  }
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(1, 11, 65, 1002),  // size
+                       ::testing::Values(1, 4),             // incX
+                       ::testing::Values(1, 3),             // incY
+                       ::testing::Values(0, 5),             // gap
+                       ::testing::Values(1, 7, 513)         // batch_size
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 3),      // incY
+                                      ::testing::Values(0, 5),      // gap
+                                      ::testing::Values(1, 7)  // batch_size
+);
+#endif
+
+class DotBatchedFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(DotBatchedFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(dot_batched, DotBatchedFloat, combi);
+
+#if DOUBLE_SUPPORT
+class DotBatchedDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(DotBatchedDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(dot_batched, DotBatchedDouble, combi);
+#endif
@@ -25,14 +25,15 @@
 
 #include "blas_test.hpp"
 
-using combination_t = std::tuple<int, int, int>;
+using combination_t = std::tuple<int, int, int, blas::Accuracy>;
 
 template <typename scalar_t>
 void run_test(const combination_t combi) {
   int size;
   int incX;
   int incY;
-  std::tie(size, incX, incY) = combi;
+  blas::Accuracy accuracy;
+  std::tie(size, incX, incY, accuracy) = combi;
 
   // Input vectors
   std::vector<scalar_t> x_v(size * incX);
@@ -59,7 +60,7 @@ void run_test(const combination_t combi) {
   auto gpu_out_s = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
   ex.get_policy_handler().copy_to_device(out_s.data(), gpu_out_s, 1);
 
-  _dot(ex, size, gpu_x_v, incX, gpu_y_v, incY, gpu_out_s);
+  _dot(ex, size, gpu_x_v, incX, gpu_y_v, incY, gpu_out_s, accuracy);
   auto event = ex.get_policy_handler().copy_to_host(gpu_out_s, out_s.data(), 1);
   ex.get_policy_handler().wait(event);
 
@@ -67,23 +68,104 @@ void run_test(const combination_t combi) {
   utils::almost_equal(out_s[0], out_cpu_s);
 }
 
+// Ill-conditioned dot product: many large terms are cancelled by a single
+// one, leaving a result made of their fractional parts. The compensated and
+// wide modes must stay within a tight bound of the exact result.
+void run_cancelling_test(const blas::Accuracy accuracy) {
+  const int size = 1 << 14;
+  const float big = 1048576.0f;
+
+  std::vector<float> x_v(size, 1.0f);
+  std::vector<float> y_v(size);
+  // The terms and their sum are exact in double
+  double exact = 0.0;
+  for (int i = 0; i < size - 1; i++) {
+    y_v[i] = big + 0.125f * (i % 8);
+    exact += 0.125 * (i % 8);
+  }
+  y_v[size - 1] = -big * (size - 1);
+  const double bound = 1e-3 * exact;
+
+  std::vector<float> out_s(1, 10.0f);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<float>(x_v, size);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<float>(y_v, size);
+  auto gpu_out_s = blas::make_sycl_iterator_buffer<float>(int(1));
+
+  _dot(ex, size, gpu_x_v, 1, gpu_y_v, 1, gpu_out_s, accuracy);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_out_s, out_s.data(), 1);
+  ex.get_policy_handler().wait(event);
+
+  const double error = std::abs(static_cast<double>(out_s[0]) - exact);
+  ASSERT_LE(error, bound);
+}
+
+// Long sum of a value that is not exact in float: the rounding error of a
+// serial sum grows with the length, the pairwise one with its logarithm.
+// The mode is given as a template argument.
+void run_pairwise_test(const int size) {
+  std::vector<float> x_v(size, 1.0f);
+  std::vector<float> y_v(size, 0.1f);
+  const double exact = static_cast<double>(0.1f) * size;
+  const double bound = 1e-5 * exact;
+
+  std::vector<float> out_s(1, 10.0f);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<float>(x_v, size);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<float>(y_v, size);
+  auto gpu_out_s = blas::make_sycl_iterator_buffer<float>(int(1));
+
+  _dot<blas::Accuracy::pairwise>(ex, size, gpu_x_v, 1, gpu_y_v, 1, gpu_out_s);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_out_s, out_s.data(), 1);
+  ex.get_policy_handler().wait(event);
+
+  const double error = std::abs(static_cast<double>(out_s[0]) - exact);
+  ASSERT_LE(error, bound);
+}
+
 #ifdef STRESS_TESTING
 const auto combi =
     ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
                        ::testing::Values(1, 4),                   // incX
-                       ::testing::Values(1, 3)                    // incY
+                       ::testing::Values(1, 3),                   // incY
+                       ::testing::Values(blas::Accuracy::standard,
+                                         blas::Accuracy::compensated,
+                                         blas::Accuracy::pairwise,
+                                         blas::Accuracy::wide)  // accuracy
     );
 #else
-const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
-                                      ::testing::Values(1, 4),      // incX
-                                      ::testing::Values(1, 3)       // incY
-);
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1002),  // size
+                       ::testing::Values(1, 4),      // incX
+                       ::testing::Values(1, 3),      // incY
+                       ::testing::Values(blas::Accuracy::standard,
+                                         blas::Accuracy::compensated,
+                                         blas::Accuracy::pairwise,
+                                         blas::Accuracy::wide)  // accuracy
+    );
 #endif
 
 class DotFloat : public ::testing::TestWithParam<combination_t> {};
 TEST_P(DotFloat, test) { run_test<float>(GetParam()); };
 INSTANTIATE_TEST_SUITE_P(dot, DotFloat, combi);
 
+class DotCancellingFloat : public ::testing::TestWithParam<blas::Accuracy> {};
+TEST_P(DotCancellingFloat, test) { run_cancelling_test(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(dot, DotCancellingFloat,
+                         ::testing::Values(blas::Accuracy::compensated,
+                                           blas::Accuracy::wide));
+
+class DotPairwiseFloat : public ::testing::TestWithParam<int> {};
+TEST_P(DotPairwiseFloat, test) { run_pairwise_test(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(dot, DotPairwiseFloat,
+                         ::testing::Values(1 << 22, 3000017));
+
 #if DOUBLE_SUPPORT
 class DotDouble : public ::testing::TestWithParam<combination_t> {};
 TEST_P(DotDouble, test) { run_test<double>(GetParam()); };
@@ -25,17 +25,21 @@
 
 #include "blas_test.hpp"
 
-using combination_t = std::tuple<int, int>;
+using combination_t = std::tuple<int, int, double>;
 
 template <typename scalar_t>
 void run_test(const combination_t combi) {
   int size;
   int incX;
-  std::tie(size, incX) = combi;
+  double scale;
+  std::tie(size, incX, scale) = combi;
 
-  // Input vectors
+  // Input vectors, scaled so that the squares overflow or underflow
   std::vector<scalar_t> x_v(size * incX);
   fill_random(x_v);
+  for (auto &x : x_v) {
+    x *= static_cast<scalar_t>(scale);
+  }
 
   // Output vector
   std::vector<scalar_t> out_s(1, 10.0);
@@ -61,9 +65,11 @@ void run_test(const combination_t combi) {
   ASSERT_TRUE(utils::almost_equal(out_s[0], out_cpu_s));
 }
 
-const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
-                                      ::testing::Values(1, 4)       // incX
-);
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1002, 1002400),  // size
+                       ::testing::Values(1, 4),               // incX
+                       ::testing::Values(1.0, 1e20, 1e-20)    // scale
+    );
 
 class Nrm2Float : public ::testing::TestWithParam<combination_t> {};
 TEST_P(Nrm2Float, test) { run_test<float>(GetParam()); };
@@ -0,0 +1,113 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_reduce_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+// The user functors are part of the kernels, so the implementation is needed
+#include "interface/generic_interface.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+struct SumFunctor {
+  template <typename value_t>
+  value_t operator()(const value_t &l, const value_t &r) const {
+    return l + r;
+  }
+  template <typename value_t>
+  static constexpr value_t identity() {
+    return value_t(0);
+  }
+};
+
+struct MaxFunctor {
+  template <typename value_t>
+  value_t operator()(const value_t &l, const value_t &r) const {
+    return (l > r) ? l : r;
+  }
+  template <typename value_t>
+  static constexpr value_t identity() {
+    return std::numeric_limits<value_t>::lowest();
+  }
+};
+
+using combination_t = std::tuple<int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  int incX;
+  std::tie(size, incX) = combi;
+  const scalar_t init = 2.5;
+
+  // Input vector
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+
+  // Reference implementation
+  scalar_t sum_cpu = init;
+  scalar_t max_cpu = init;
+  for (int i = 0; i < size; ++i) {
+    sum_cpu += x_v[i * incX];
+    max_cpu = std::max(max_cpu, x_v[i * incX]);
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto vx = make_vector_view(ex, gpu_x_v, incX, size);
+
+  auto sum = _reduce(ex, vx, SumFunctor(), init).get(ex);
+  auto max = _reduce(ex, vx, MaxFunctor(), init).get(ex);
+
+  // Validate the result
+  ASSERT_TRUE(utils::almost_equal(sum, sum_cpu));
+  ASSERT_EQ(max, max_cpu);
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4)                    // incX
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4)       // incX
+);
+#endif
+
+class ReduceFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(ReduceFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(reduce, ReduceFloat, combi);
+
+#if DOUBLE_SUPPORT
+class ReduceDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(ReduceDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(reduce, ReduceDouble, combi);
+#endif
@@ -0,0 +1,111 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_rot_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int rows;
+  int size;
+  int incX;
+  int num_rotations;
+  std::tie(rows, size, incX, num_rotations) = combi;
+  const int stride = size * incX;
+
+  // Input/Output rows
+  std::vector<scalar_t> x_v(rows * stride);
+  fill_random(x_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+
+  // Random rotations, later rotations may reuse the rows of earlier ones
+  std::vector<int> rows_i(num_rotations);
+  std::vector<int> rows_j(num_rotations);
+  std::vector<scalar_t> c_v(num_rotations);
+  std::vector<scalar_t> s_v(num_rotations);
+  for (int r = 0; r < num_rotations; r++) {
+    rows_i[r] = rand() % rows;
+    rows_j[r] = (rows_i[r] + 1 + rand() % (rows - 1)) % rows;
+    const scalar_t angle = static_cast<scalar_t>(rand() % 628) / 100;
+    c_v[r] = std::cos(angle);
+    s_v[r] = std::sin(angle);
+  }
+
+  // Reference implementation, one rotation after the other
+  for (int r = 0; r < num_rotations; r++) {
+    reference_blas::rot(size, x_cpu_v.data() + rows_i[r] * stride, incX,
+                        x_cpu_v.data() + rows_j[r] * stride, incX, c_v[r],
+                        s_v[r]);
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(rows * stride));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, rows * stride);
+  auto gpu_c_v = blas::make_sycl_iterator_buffer<scalar_t>(num_rotations);
+  ex.get_policy_handler().copy_to_device(c_v.data(), gpu_c_v, num_rotations);
+  auto gpu_s_v = blas::make_sycl_iterator_buffer<scalar_t>(num_rotations);
+  ex.get_policy_handler().copy_to_device(s_v.data(), gpu_s_v, num_rotations);
+
+  auto schedule = blas::make_rotation_schedule(ex, num_rotations,
+                                               rows_i.data(), rows_j.data());
+  _rot_batched(ex, rows, size, gpu_x_v, incX, stride, schedule, gpu_c_v,
+               gpu_s_v);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_x_v, x_v.data(),
+                                                    rows * stride);
+  ex.get_policy_handler().wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(2, 16, 64),            // rows
+                       ::testing::Values(11, 65, 1002, 10024),  // size
+                       ::testing::Values(1, 4),                 // incX
+                       ::testing::Values(1, 8, 200)             // rotations
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(2, 16),     // rows
+                                      ::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 8, 200)  // rotations
+);
+#endif
+
+class RotBatchedFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(RotBatchedFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(rot_batched, RotBatchedFloat, combi);
+
+#if DOUBLE_SUPPORT
+class RotBatchedDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(RotBatchedDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(rot_batched, RotBatchedDouble, combi);
+#endif
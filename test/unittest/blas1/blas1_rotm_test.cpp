@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_rotm_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  int incX;
+  int incY;
+  int flag;
+  std::tie(size, incX, incY, flag) = combi;
+
+  // Input/Output vectors
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+
+  std::vector<scalar_t> y_v(size * incY);
+  fill_random(y_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+
+  // Transformation, the entries implied by the flag are left random
+  std::vector<scalar_t> param(5);
+  fill_random(param);
+  param[0] = static_cast<scalar_t>(flag);
+
+  // Reference implementation
+  reference_blas::rotm(size, x_cpu_v.data(), incX, y_cpu_v.data(), incY,
+                       param.data());
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+  auto gpu_param = blas::make_sycl_iterator_buffer<scalar_t>(int(5));
+  ex.get_policy_handler().copy_to_device(param.data(), gpu_param, 5);
+
+  _rotm(ex, size, gpu_x_v, incX, gpu_y_v, incY, gpu_param);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_x_v, x_v.data(), size * incX);
+  ex.get_policy_handler().wait(event);
+  event =
+      ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(), size * incY);
+  ex.get_policy_handler().wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(1, 3),                   // incY
+                       ::testing::Values(-2, -1, 0, 1)            // flag
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),     // size
+                                      ::testing::Values(1, 4),         // incX
+                                      ::testing::Values(1, 3),         // incY
+                                      ::testing::Values(-2, -1, 0, 1)  // flag
+);
+#endif
+
+class RotmFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(RotmFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(rotm, RotmFloat, combi);
+
+#if DOUBLE_SUPPORT
+class RotmDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(RotmDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(rotm, RotmDouble, combi);
+#endif
@@ -0,0 +1,129 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_rotmg_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  int incX;
+  int incY;
+  std::tie(size, incX, incY) = combi;
+
+  // Input/Output vectors
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+
+  std::vector<scalar_t> y_v(size * incY);
+  fill_random(y_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+
+  // Scaling factors must be positive
+  std::vector<scalar_t> d(2);
+  fill_random(d);
+  d[0] = d[0] < 0 ? -d[0] : d[0];
+  d[1] = d[1] < 0 ? -d[1] : d[1];
+
+  // Reference implementation, zeroes y[0] and applies the result
+  scalar_t d1_cpu = d[0];
+  scalar_t d2_cpu = d[1];
+  scalar_t x1_cpu = x_v[0];
+  std::vector<scalar_t> param_cpu(5, scalar_t(0));
+  reference_blas::rotmg(&d1_cpu, &d2_cpu, &x1_cpu, y_v[0], param_cpu.data());
+  reference_blas::rotm(size, x_cpu_v.data(), incX, y_cpu_v.data(), incY,
+                       param_cpu.data());
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+  auto gpu_d1 = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
+  ex.get_policy_handler().copy_to_device(&d[0], gpu_d1, 1);
+  auto gpu_d2 = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
+  ex.get_policy_handler().copy_to_device(&d[1], gpu_d2, 1);
+  auto gpu_x1 = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x1, 1);
+  auto gpu_y1 = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y1, 1);
+  auto gpu_param = blas::make_sycl_iterator_buffer<scalar_t>(int(5));
+
+  // The transformation never leaves the device
+  _rotmg(ex, gpu_d1, gpu_d2, gpu_x1, gpu_y1, gpu_param);
+  _rotm(ex, size, gpu_x_v, incX, gpu_y_v, incY, gpu_param);
+
+  scalar_t d1;
+  scalar_t d2;
+  scalar_t x1;
+  auto event = ex.get_policy_handler().copy_to_host(gpu_d1, &d1, 1);
+  ex.get_policy_handler().wait(event);
+  event = ex.get_policy_handler().copy_to_host(gpu_d2, &d2, 1);
+  ex.get_policy_handler().wait(event);
+  event = ex.get_policy_handler().copy_to_host(gpu_x1, &x1, 1);
+  ex.get_policy_handler().wait(event);
+  event =
+      ex.get_policy_handler().copy_to_host(gpu_x_v, x_v.data(), size * incX);
+  ex.get_policy_handler().wait(event);
+  event =
+      ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(), size * incY);
+  ex.get_policy_handler().wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::almost_equal(d1, d1_cpu));
+  ASSERT_TRUE(utils::almost_equal(d2, d2_cpu));
+  ASSERT_TRUE(utils::almost_equal(x1, x1_cpu));
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(1, 3)                    // incY
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 3)       // incY
+);
+#endif
+
+class RotmgFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(RotmgFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(rotmg, RotmgFloat, combi);
+
+#if DOUBLE_SUPPORT
+class RotmgDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(RotmgDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(rotmg, RotmgDouble, combi);
+#endif
@@ -0,0 +1,96 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_scal_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, scalar_t, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  int incX;
+  int gap;
+  int batch_size;
+  std::tie(size, alpha, incX, gap, batch_size) = combi;
+  const int strideX = size * incX + gap;
+
+  // Input/output vectors
+  std::vector<scalar_t> x_v(strideX * batch_size);
+  fill_random(x_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+
+  // Reference implementation
+  for (int b = 0; b < batch_size; ++b) {
+    reference_blas::scal(size, alpha, x_cpu_v.data() + b * strideX, incX);
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(x_v.size()));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, x_v.size());
+
+  _scal_batched(ex, size, alpha, gpu_x_v, incX, strideX, batch_size);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_x_v, x_v.data(), x_v.size());
+  ex.get_policy_handler().wait(event);
+
+  // Validate the result, the gaps between the vectors must be untouched
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(1, 11, 65, 257, 1002),  // size
+                       ::testing::Values(0.0, 1.5),              // alpha
+                       ::testing::Values(1, 2, 5),               // incX
+                       ::testing::Values(0, 3, 17),              // gap
+                       ::testing::Values(1, 7, 513)              // batch_size
+    );
+#else
+const auto combi =
+    ::testing::Combine(::testing::Values(1, 11, 65, 257),  // size
+                       ::testing::Values(1.5),             // alpha
+                       ::testing::Values(1, 3),            // incX
+                       ::testing::Values(0, 5),            // gap
+                       ::testing::Values(1, 7)             // batch_size
+    );
+#endif
+
+class ScalBatchedFloat
+    : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(ScalBatchedFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(scal_batched, ScalBatchedFloat, combi);
+
+#if DOUBLE_SUPPORT
+class ScalBatchedDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(ScalBatchedDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(scal_batched, ScalBatchedDouble, combi);
+#endif
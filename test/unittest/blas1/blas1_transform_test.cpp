@@ -0,0 +1,121 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_transform_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+// The user functors are part of the kernels, so the implementation is needed
+#include "interface/generic_interface.hpp"
+
+#include <cmath>
+
+template <typename scalar_t>
+struct ShiftedExp {
+  scalar_t shift;
+  scalar_t operator()(const scalar_t &x) const {
+    return cl::sycl::exp(x - shift);
+  }
+};
+
+struct Hypot {
+  template <typename value_t>
+  value_t operator()(const value_t &x, const value_t &y) const {
+    return cl::sycl::sqrt(x * x + y * y);
+  }
+};
+
+using combination_t = std::tuple<int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  int incX;
+  int incY;
+  std::tie(size, incX, incY) = combi;
+  const scalar_t shift = 0.75;
+
+  // Input vectors
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(size * incY);
+  fill_random(y_v);
+
+  // Output vectors
+  std::vector<scalar_t> exp_v(size, 10.0);
+  std::vector<scalar_t> hyp_v(size, 10.0);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+  auto gpu_exp_v = blas::make_sycl_iterator_buffer<scalar_t>(size);
+  auto gpu_hyp_v = blas::make_sycl_iterator_buffer<scalar_t>(size);
+  auto vx = make_vector_view(ex, gpu_x_v, incX, size);
+  auto vy = make_vector_view(ex, gpu_y_v, incY, size);
+  auto vexp = make_vector_view(ex, gpu_exp_v, 1, size);
+  auto vhyp = make_vector_view(ex, gpu_hyp_v, 1, size);
+
+  _transform(ex, vx, vexp, ShiftedExp<scalar_t>{shift});
+  _transform(ex, vx, vy, vhyp, Hypot());
+  auto event0 = ex.get_policy_handler().copy_to_host(gpu_exp_v, exp_v.data(),
+                                                     size);
+  auto event1 = ex.get_policy_handler().copy_to_host(gpu_hyp_v, hyp_v.data(),
+                                                     size);
+  ex.get_policy_handler().wait(event0, event1);
+
+  // Validate the result
+  for (int i = 0; i < size; ++i) {
+    const scalar_t x = x_v[i * incX];
+    const scalar_t y = y_v[i * incY];
+    ASSERT_TRUE(utils::almost_equal(exp_v[i], std::exp(x - shift)));
+    ASSERT_TRUE(utils::almost_equal(hyp_v[i], std::sqrt(x * x + y * y)));
+  }
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(1, 3)                    // incY
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 3)       // incY
+);
+#endif
+
+class TransformFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(TransformFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(transform, TransformFloat, combi);
+
+#if DOUBLE_SUPPORT
+class TransformDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(TransformDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(transform, TransformDouble, combi);
+#endif
@@ -0,0 +1,183 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_usm_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#ifdef SYCL_BLAS_USE_USM
+// The routines are instantiated on USM pointers in the test
+#include "sycl_blas.hpp"
+
+using usm_executor_t = blas::Executor<blas::PolicyHandler<blas::usm_policy>>;
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, scalar_t, int, bool>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  int incX;
+  bool implicit_ordering;
+  std::tie(size, alpha, incX, implicit_ordering) = combi;
+
+  // Input vector
+  std::vector<scalar_t> x_v(2 * size * incX);
+  fill_random(x_v);
+
+  // Output vectors
+  std::vector<scalar_t> y_v(2 * size, 10.0);
+  std::vector<scalar_t> z_v(2 * size, 0.0);
+  std::vector<scalar_t> y_cpu_v(y_v);
+  std::vector<scalar_t> z_cpu_v(z_v);
+
+  // Reference implementation
+  reference_blas::copy(2 * size, x_v.data(), incX, z_cpu_v.data(), 1);
+  reference_blas::scal(2 * size, alpha, z_cpu_v.data(), 1);
+  reference_blas::axpy(2 * size, alpha, x_v.data(), incX, y_cpu_v.data(), 1);
+
+  // SYCL implementation
+  auto q = make_queue();
+  usm_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+  policy_handler.set_implicit_ordering(implicit_ordering);
+  ASSERT_EQ(policy_handler.is_implicit_ordering(), implicit_ordering);
+
+  // Device pointers
+  auto gpu_x_v = policy_handler.template allocate<scalar_t>(2 * size * incX);
+  auto gpu_y_v = policy_handler.template allocate<scalar_t>(2 * size);
+  auto gpu_z_v = policy_handler.template allocate<scalar_t>(2 * size);
+  auto copies = blas::concatenate_vectors(
+      policy_handler.copy_to_device(x_v.data(), gpu_x_v, 2 * size * incX),
+      policy_handler.copy_to_device(y_v.data(), gpu_y_v, 2 * size));
+
+  // The halves of each output are independent slices of one allocation, each
+  // only depending on the events it is given when there is no implicit
+  // ordering
+  auto copied = blas::concatenate_vectors(
+      _copy(ex, size, gpu_x_v, incX, gpu_z_v, 1, copies),
+      _copy(ex, size, gpu_x_v + size * incX, incX, gpu_z_v + size, 1, copies));
+  auto scaled = blas::concatenate_vectors(
+      _scal(ex, size, alpha, gpu_z_v, 1, copied),
+      _scal(ex, size, alpha, gpu_z_v + size, 1, copied));
+  auto updated = blas::concatenate_vectors(
+      _axpy(ex, size, alpha, gpu_x_v, incX, gpu_y_v, 1, copies),
+      _axpy(ex, size, alpha, gpu_x_v + size * incX, incX, gpu_y_v + size, 1,
+            copies));
+
+  policy_handler.add_dependencies(blas::concatenate_vectors(scaled, updated));
+  auto event = blas::concatenate_vectors(
+      policy_handler.copy_to_host(gpu_y_v, y_v.data(), 2 * size),
+      policy_handler.copy_to_host(gpu_z_v, z_v.data(), 2 * size));
+  policy_handler.wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(z_v, z_cpu_v));
+
+  policy_handler.deallocate(gpu_x_v);
+  policy_handler.deallocate(gpu_y_v);
+  policy_handler.deallocate(gpu_z_v);
+}
+
+template <typename scalar_t>
+void run_reduction_test(const combination_t<scalar_t> combi) {
+  using tuple_t = IndexValueTuple<scalar_t, int>;
+
+  int size;
+  scalar_t alpha;
+  int incX;
+  bool implicit_ordering;
+  std::tie(size, alpha, incX, implicit_ordering) = combi;
+
+  // Input vectors
+  std::vector<scalar_t> x_v(size * incX);
+  std::vector<scalar_t> y_v(size);
+  fill_random(x_v);
+  fill_random(y_v);
+
+  // Output values
+  std::vector<scalar_t> dot_v(1, 10.0);
+  std::vector<tuple_t> iamax_v(1, tuple_t(0, 0.0));
+
+  // Reference implementation
+  const scalar_t dot_cpu_s =
+      reference_blas::dot(size, x_v.data(), incX, y_v.data(), 1);
+  const int iamax_cpu_s = reference_blas::iamax(size, x_v.data(), incX);
+
+  // SYCL implementation
+  auto q = make_queue();
+  usm_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+  policy_handler.set_implicit_ordering(implicit_ordering);
+
+  // Device pointers
+  auto gpu_x_v = policy_handler.template allocate<scalar_t>(size * incX);
+  auto gpu_y_v = policy_handler.template allocate<scalar_t>(size);
+  auto gpu_dot_s = policy_handler.template allocate<scalar_t>(1);
+  auto gpu_iamax_s = policy_handler.template allocate<tuple_t>(1);
+  auto copies = blas::concatenate_vectors(
+      policy_handler.copy_to_device(x_v.data(), gpu_x_v, size * incX),
+      policy_handler.copy_to_device(y_v.data(), gpu_y_v, size));
+
+  auto reduced = blas::concatenate_vectors(
+      _dot(ex, size, gpu_x_v, incX, gpu_y_v, 1, gpu_dot_s,
+           blas::Accuracy::standard, copies),
+      _iamax(ex, size, gpu_x_v, incX, gpu_iamax_s, copies));
+
+  policy_handler.add_dependencies(reduced);
+  auto event = blas::concatenate_vectors(
+      policy_handler.copy_to_host(gpu_dot_s, dot_v.data(), 1),
+      policy_handler.copy_to_host(gpu_iamax_s, iamax_v.data(), 1));
+  policy_handler.wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::almost_equal(dot_v[0], dot_cpu_s));
+  ASSERT_EQ(iamax_cpu_s, iamax_v[0].ind);
+
+  policy_handler.deallocate(gpu_x_v);
+  policy_handler.deallocate(gpu_y_v);
+  policy_handler.deallocate(gpu_dot_s);
+  policy_handler.deallocate(gpu_iamax_s);
+}
+
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1002),    // size
+                       ::testing::Values(0.0, 1.5),    // alpha
+                       ::testing::Values(1, 4),        // incX
+                       ::testing::Values(true, false)  // implicit ordering
+    );
+
+class UsmFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(UsmFloat, test) { run_test<float>(GetParam()); };
+TEST_P(UsmFloat, reduction) { run_reduction_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(usm, UsmFloat, combi);
+
+#if DOUBLE_SUPPORT
+class UsmDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(UsmDouble, test) { run_test<double>(GetParam()); };
+TEST_P(UsmDouble, reduction) { run_reduction_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(usm, UsmDouble, combi);
+#endif
+#endif  // SYCL_BLAS_USE_USM
@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_waxpby_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, scalar_t, scalar_t, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  scalar_t beta;
+  int incX;
+  int incY;
+  int incW;
+  std::tie(size, alpha, beta, incX, incY, incW) = combi;
+
+  // Input vectors
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(size * incY);
+  fill_random(y_v);
+
+  // Output vector
+  std::vector<scalar_t> w_v(size * incW, 10.0);
+  std::vector<scalar_t> w_cpu_v(size * incW, 10.0);
+
+  // Reference implementation
+  reference_blas::copy(size, y_v.data(), incY, w_cpu_v.data(), incW);
+  reference_blas::scal(size, beta, w_cpu_v.data(), incW);
+  reference_blas::axpy(size, alpha, x_v.data(), incX, w_cpu_v.data(), incW);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+  auto gpu_w_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incW));
+  ex.get_policy_handler().copy_to_device(w_v.data(), gpu_w_v, size * incW);
+
+  _waxpby(ex, size, alpha, gpu_x_v, incX, beta, gpu_y_v, incY, gpu_w_v, incW);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_w_v, w_v.data(), size * incW);
+  ex.get_policy_handler().wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(w_v, w_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(0.0, 1.5),               // alpha
+                       ::testing::Values(0.0, -0.5),              // beta
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(1, 3),                   // incY
+                       ::testing::Values(1, 2)                    // incW
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1.5),       // alpha
+                                      ::testing::Values(-0.5),      // beta
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 3),      // incY
+                                      ::testing::Values(1, 2)       // incW
+);
+#endif
+
+class WaxpbyFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(WaxpbyFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(waxpby, WaxpbyFloat, combi);
+
+#if DOUBLE_SUPPORT
+class WaxpbyDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(WaxpbyDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(waxpby, WaxpbyDouble, combi);
+#endif
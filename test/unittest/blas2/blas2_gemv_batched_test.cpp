@@ -0,0 +1,121 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, bool, T, T, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  bool trans;
+  scalar_t alpha;
+  scalar_t beta;
+  int incX;
+  int incY;
+  int batch_size;
+  std::tie(m, n, trans, alpha, beta, incX, incY, batch_size) = combi;
+
+  const char *t_str = trans ? "t" : "n";
+
+  int lda = m;
+  int x = trans ? m : n;
+  int y = trans ? n : m;
+  int stride_a = lda * n;
+  int stride_x = x * incX;
+  int stride_y = y * incY;
+
+  // Input matrices
+  std::vector<scalar_t> a_m(stride_a * batch_size);
+  // Input vectors
+  std::vector<scalar_t> b_v(stride_x * batch_size);
+  // output vectors
+  std::vector<scalar_t> c_v_gpu_result(stride_y * batch_size, scalar_t(10.0));
+  // output system vectors
+  std::vector<scalar_t> c_v_cpu(stride_y * batch_size, scalar_t(10.0));
+  fill_random(a_m);
+  fill_random(b_v);
+
+  // SYSTEM GEMV
+  for (int bs = 0; bs < batch_size; bs++) {
+    reference_blas::gemv(t_str, m, n, alpha, a_m.data() + bs * stride_a, lda,
+                         b_v.data() + bs * stride_x, incX, beta,
+                         c_v_cpu.data() + bs * stride_y, incY);
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_m.size());
+  auto v_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_v, b_v.size());
+  auto v_c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(
+      c_v_gpu_result, c_v_gpu_result.size());
+
+  // SYCL GEMV BATCHED
+  _gemv_batched(ex, *t_str, m, n, alpha, m_a_gpu, lda, stride_a, v_b_gpu, incX,
+                stride_x, beta, v_c_gpu, incY, stride_y, batch_size);
+  auto event = ex.get_policy_handler().copy_to_host(
+      v_c_gpu, c_v_gpu_result.data(), c_v_gpu_result.size());
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_v_gpu_result, c_v_cpu));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(1, 11, 65, 255),  // m
+                       ::testing::Values(1, 14, 63, 257),  // n
+                       ::testing::Values(true, false),     // trans
+                       ::testing::Values(0.0, 1.0, 1.5),   // alpha
+                       ::testing::Values(0.0, 1.0, 1.5),   // beta
+                       ::testing::Values(1, 2),            // incX
+                       ::testing::Values(1, 3),            // incY
+                       ::testing::Values(1, 5, 1000)       // batch_size
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values(11, 65),       // m
+                                      ::testing::Values(14, 63),       // n
+                                      ::testing::Values(true, false),  // trans
+                                      ::testing::Values(1.5),          // alpha
+                                      ::testing::Values(0.0, 1.5),     // beta
+                                      ::testing::Values(2),            // incX
+                                      ::testing::Values(3),            // incY
+                                      ::testing::Values(1, 100)  // batch_size
+);
+#endif
+
+class GemvBatchedFloat
+    : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GemvBatchedFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemv_batched, GemvBatchedFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GemvBatchedDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(GemvBatchedDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemv_batched, GemvBatchedDouble, combi);
+#endif
@@ -0,0 +1,117 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_multi_vector_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, int, bool, T, T, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  bool trans;
+  scalar_t alpha;
+  scalar_t beta;
+  int ld_mul;
+  std::tie(m, n, k, trans, alpha, beta, ld_mul) = combi;
+
+  const char *t_str = trans ? "t" : "n";
+
+  int lda = m * ld_mul;
+  int x = trans ? m : n;
+  int y = trans ? n : m;
+  int ldx = x * ld_mul;
+  int ldy = y * ld_mul;
+
+  // Input matrix
+  std::vector<scalar_t> a_m(lda * n);
+  // Input vectors
+  std::vector<scalar_t> b_m(ldx * k);
+  // output vectors
+  std::vector<scalar_t> c_m_gpu_result(ldy * k, scalar_t(10.0));
+  // output system vectors
+  std::vector<scalar_t> c_m_cpu(ldy * k, scalar_t(10.0));
+  fill_random(a_m);
+  fill_random(b_m);
+
+  // SYSTEM GEMV
+  for (int v = 0; v < k; v++) {
+    reference_blas::gemv(t_str, m, n, alpha, a_m.data(), lda,
+                         b_m.data() + v * ldx, 1, beta,
+                         c_m_cpu.data() + v * ldy, 1);
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_m.size());
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, b_m.size());
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(
+      c_m_gpu_result, c_m_gpu_result.size());
+
+  // SYCL GEMV MULTI VECTOR
+  _gemv_multi_vector(ex, *t_str, m, n, k, alpha, m_a_gpu, lda, m_b_gpu, ldx,
+                     beta, m_c_gpu, ldy);
+  auto event = ex.get_policy_handler().copy_to_host(
+      m_c_gpu, c_m_gpu_result.data(), c_m_gpu_result.size());
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu_result, c_m_cpu));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 255, 1023),  // m
+                       ::testing::Values(14, 63, 257, 1010),  // n
+                       ::testing::Values(1, 4, 16, 21),       // k
+                       ::testing::Values(true, false),        // trans
+                       ::testing::Values(0.0, 1.0, 1.5),      // alpha
+                       ::testing::Values(0.0, 1.0, 1.5),      // beta
+                       ::testing::Values(1, 2)                // ld_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values(11, 1023),     // m
+                                      ::testing::Values(14, 1010),     // n
+                                      ::testing::Values(3, 21),        // k
+                                      ::testing::Values(true, false),  // trans
+                                      ::testing::Values(1.5),          // alpha
+                                      ::testing::Values(0.0, 1.5),     // beta
+                                      ::testing::Values(2)  // ld_mul
+);
+#endif
+
+class GemvMultiVectorFloat
+    : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GemvMultiVectorFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemv_multi_vector, GemvMultiVectorFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GemvMultiVectorDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(GemvMultiVectorDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemv_multi_vector, GemvMultiVectorDouble, combi);
+#endif
@@ -0,0 +1,100 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_out_of_core_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, int, char, char, T, T, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  int ld_mul;
+  int tile;
+  std::tie(m, n, k, transa, transb, alpha, beta, ld_mul, tile) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  int lda = std::max(1, ((transa != 'n') ? k : m) * ld_mul);
+  int ldb = std::max(1, ((transb != 'n') ? n : k) * ld_mul);
+  int ldc = m * ld_mul;
+
+  std::vector<scalar_t> a_m(lda * ((transa != 'n') ? m : k));
+  std::vector<scalar_t> b_m(ldb * ((transb != 'n') ? k : n));
+  std::vector<scalar_t> c_m_gpu(ldc * n);
+  std::vector<scalar_t> c_m_cpu(ldc * n);
+
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  std::copy(c_m_gpu.begin(), c_m_gpu.end(), c_m_cpu.begin());
+
+  // Use system blas to create a reference output
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_m.data(), lda,
+                       b_m.data(), ldb, beta, c_m_cpu.data(), ldc);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // The device memory allowed for tiles of the given size, 0 for the default
+  size_t max_bytes = 5 * tile * tile * sizeof(scalar_t);
+  // SYCL BLAS GEMM streaming tiles of the host matrices
+  auto event = _gemm_out_of_core(ex, transa, transb, m, n, k, alpha,
+                                 a_m.data(), lda, b_m.data(), ldb, beta,
+                                 c_m_gpu.data(), ldc, max_bytes);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+}
+
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 512),     // m
+                       ::testing::Values(14, 49),      // n
+                       ::testing::Values(0, 21, 67),   // k
+                       ::testing::Values('n', 't'),    // transa
+                       ::testing::Values('n', 't'),    // transb
+                       ::testing::Values(1.5),         // alpha
+                       ::testing::Values(0.0, 1.5),    // beta
+                       ::testing::Values(1, 2),        // ld_mul
+                       ::testing::Values(0, 16)        // tile
+    );
+
+class GemmOutOfCoreFloat
+    : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GemmOutOfCoreFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemm_out_of_core, GemmOutOfCoreFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GemmOutOfCoreDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(GemmOutOfCoreDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemm_out_of_core, GemmOutOfCoreDouble, combi);
+#endif
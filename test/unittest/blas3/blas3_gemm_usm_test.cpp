@@ -0,0 +1,112 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_usm_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#ifdef SYCL_BLAS_USE_USM
+// The routines are instantiated on USM pointers in the test
+#include "sycl_blas.hpp"
+
+using usm_executor_t = blas::Executor<blas::PolicyHandler<blas::usm_policy>>;
+
+template <typename T>
+using combination_t = std::tuple<int, int, int, char, char, T, T>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  std::tie(m, n, k, transa, transb, alpha, beta) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  const int lda = (transa != 'n') ? k : m;
+  const int ldb = (transb != 'n') ? n : k;
+  const int ldc = m;
+
+  std::vector<scalar_t> a_m(m * k);
+  std::vector<scalar_t> b_m(k * n);
+  std::vector<scalar_t> c_m_gpu(m * n);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  std::vector<scalar_t> c_m_cpu(c_m_gpu);
+
+  // Reference implementation
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_m.data(), lda,
+                       b_m.data(), ldb, beta, c_m_cpu.data(), ldc);
+
+  // SYCL implementation
+  auto q = make_queue();
+  usm_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+
+  // Device pointers
+  auto m_a_gpu = policy_handler.template allocate<scalar_t>(m * k);
+  auto m_b_gpu = policy_handler.template allocate<scalar_t>(k * n);
+  auto m_c_gpu = policy_handler.template allocate<scalar_t>(m * n);
+  policy_handler.copy_to_device(a_m.data(), m_a_gpu, m * k);
+  policy_handler.copy_to_device(b_m.data(), m_b_gpu, k * n);
+  policy_handler.copy_to_device(c_m_gpu.data(), m_c_gpu, m * n);
+
+  _gemm(ex, transa, transb, m, n, k, alpha, m_a_gpu, lda, m_b_gpu, ldb, beta,
+        m_c_gpu, ldc);
+  auto event = policy_handler.copy_to_host(m_c_gpu, c_m_gpu.data(), m * n);
+  policy_handler.wait(event);
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+
+  policy_handler.deallocate(m_a_gpu);
+  policy_handler.deallocate(m_b_gpu);
+  policy_handler.deallocate(m_c_gpu);
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 512),   // m
+                                      ::testing::Values(14, 49),    // n
+                                      ::testing::Values(21),        // k
+                                      ::testing::Values('n', 't'),  // transa
+                                      ::testing::Values('n', 't'),  // transb
+                                      ::testing::Values(1.5),       // alpha
+                                      ::testing::Values(0.0, 1.5)   // beta
+);
+
+class GemmUsmFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GemmUsmFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemm_usm, GemmUsmFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GemmUsmDouble : public ::testing::TestWithParam<combination_t<double>> {
+};
+TEST_P(GemmUsmDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemm_usm, GemmUsmDouble, combi);
+#endif
+#endif  // SYCL_BLAS_USE_USM
@@ -0,0 +1,84 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_allocation_cache_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  int rounds;
+  std::tie(size, rounds) = combi;
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+  policy_handler.set_allocation_caching(true);
+
+  scalar_t *first = nullptr;
+  for (int r = 0; r < rounds; r++) {
+    std::vector<scalar_t> vX(size);
+    fill_random(vX);
+    std::vector<scalar_t> vR(size, scalar_t(0));
+
+    auto gpu_vX = policy_handler.template allocate<scalar_t>(size);
+    if (r == 0) {
+      first = gpu_vX;
+    } else {
+      // The block given back in the previous round is reused
+      ASSERT_EQ(gpu_vX, first);
+    }
+    auto event = policy_handler.copy_to_device(vX.data(), gpu_vX, size);
+    policy_handler.wait(event);
+    event = policy_handler.copy_to_host(gpu_vX, vR.data(), size);
+    policy_handler.wait(event);
+    policy_handler.template deallocate<scalar_t>(gpu_vX);
+
+    ASSERT_TRUE(utils::compare_vectors(vR, vX));
+  }
+
+  auto stats = policy_handler.get_allocation_stats();
+  ASSERT_EQ(stats.misses, size_t(1));
+  ASSERT_EQ(stats.hits, size_t(rounds - 1));
+  ASSERT_GE(stats.bytes_cached, size * sizeof(scalar_t));
+
+  policy_handler.trim();
+  ASSERT_EQ(policy_handler.get_allocation_stats().bytes_cached, size_t(0));
+  policy_handler.set_allocation_caching(false);
+}
+
+const auto combi = ::testing::Combine(::testing::Values(100, 102400),  // size
+                                      ::testing::Values(1, 4)          // rounds
+);
+
+class AllocationCacheFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(AllocationCacheFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(allocation_cache, AllocationCacheFloat, combi);
+
+#if DOUBLE_SUPPORT
+class AllocationCacheDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(AllocationCacheDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(allocation_cache, AllocationCacheDouble, combi);
+#endif
@@ -0,0 +1,79 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_host_buffer_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, bool>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  bool aligned;
+  std::tie(size, aligned) = combi;
+
+  // Room to place the data on a page boundary, or just after one
+  const size_t page = 4096 / sizeof(scalar_t);
+  std::vector<scalar_t> storage(size + 2 * page);
+  auto address = reinterpret_cast<std::uintptr_t>(storage.data());
+  size_t first = (page - (address / sizeof(scalar_t)) % page) % page;
+  scalar_t *vX = storage.data() + first + (aligned ? 0 : 1);
+
+  std::vector<scalar_t> vR(size);
+  fill_random(vR);
+  std::copy(vR.begin(), vR.end(), vX);
+  scalar_t alpha(1.5);
+  for (auto &r : vR) {
+    r *= alpha;
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+  ASSERT_EQ(policy_handler.is_zero_copy(vX),
+            aligned && policy_handler.has_host_unified_memory());
+  {
+    auto gpu_vX = policy_handler.get_host_buffer(vX, size);
+    auto event = _scal(ex, size, alpha, gpu_vX, 1);
+    policy_handler.wait(event);
+    // The data is written back when the buffer is destroyed
+  }
+
+  std::vector<scalar_t> vX_result(vX, vX + size);
+  ASSERT_TRUE(utils::compare_vectors(vX_result, vR));
+}
+
+const auto combi =
+    ::testing::Combine(::testing::Values(100, 102400),  // size
+                       ::testing::Values(true, false)   // aligned
+    );
+
+class HostBufferFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(HostBufferFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(host_buffer, HostBufferFloat, combi);
+
+#if DOUBLE_SUPPORT
+class HostBufferDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(HostBufferDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(host_buffer, HostBufferDouble, combi);
+#endif
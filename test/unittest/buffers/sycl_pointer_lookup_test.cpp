@@ -0,0 +1,88 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_pointer_lookup_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  int num_allocations;
+  std::tie(size, num_allocations) = combi;
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+
+  // More allocations than the lookup cache holds, resolved twice each
+  std::vector<scalar_t *> ptrs;
+  for (int i = 0; i < num_allocations; i++) {
+    ptrs.push_back(policy_handler.template allocate<scalar_t>(size));
+  }
+  for (int round = 0; round < 2; round++) {
+    for (auto ptr : ptrs) {
+      ASSERT_EQ(policy_handler.get_offset(ptr), 0);
+      ASSERT_EQ(policy_handler.get_offset(ptr + size - 1), size - 1);
+      auto buff = policy_handler.get_buffer(ptr + 1);
+      ASSERT_EQ(buff.get_offset(), 1);
+      ASSERT_GE(buff.get_buffer().get_count(), size_t(size));
+    }
+  }
+
+  // A freed allocation must not be resolved from the cache once its address
+  // is handed out again
+  policy_handler.template deallocate<scalar_t>(ptrs.back());
+  ptrs.back() = policy_handler.template allocate<scalar_t>(2 * size);
+  ASSERT_GE(policy_handler.get_buffer(ptrs.back()).get_buffer().get_count(),
+            size_t(2 * size));
+
+  std::vector<scalar_t> vX(2 * size);
+  fill_random(vX);
+  std::vector<scalar_t> vR(2 * size, scalar_t(0));
+  auto event = policy_handler.copy_to_device(vX.data(), ptrs.back(), 2 * size);
+  policy_handler.wait(event);
+  event = policy_handler.copy_to_host(ptrs.back(), vR.data(), 2 * size);
+  policy_handler.wait(event);
+  ASSERT_TRUE(utils::compare_vectors(vR, vX));
+
+  for (auto ptr : ptrs) {
+    policy_handler.template deallocate<scalar_t>(ptr);
+  }
+}
+
+const auto combi =
+    ::testing::Combine(::testing::Values(16, 1024),  // size
+                       ::testing::Values(1, 8)       // num_allocations
+    );
+
+class PointerLookupFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(PointerLookupFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(pointer_lookup, PointerLookupFloat, combi);
+
+#if DOUBLE_SUPPORT
+class PointerLookupDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(PointerLookupDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(pointer_lookup, PointerLookupDouble, combi);
+#endif
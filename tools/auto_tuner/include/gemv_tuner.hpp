@@ -0,0 +1,163 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_tuner.hpp
+ *
+ **************************************************************************/
+
+#include <sstream>
+#include <string>
+
+#include "gemm_tuner.hpp"
+#include "reference_gemv.hpp"
+
+template <typename element_t, typename container_t, typename executor_t>
+struct GemvArgs {
+  char trans;
+  int m;
+  int n;
+  element_t alpha;
+  container_t &a;
+  int lda;
+  container_t &x;
+  element_t beta;
+  container_t y;  // Not a reference - need new copy every time
+  container_t &refY;
+  executor_t &ex;
+  TestResult &results;
+};
+
+/*!
+ * @brief Times one GEMV launcher. The launcher is given the executor and the
+ * device buffers and returns the event of the last kernel it enqueued.
+ */
+template <typename T, typename Container, typename Executor,
+          typename Launcher>
+void tune_gemv(int r, const std::string &name,
+               GemvArgs<T, Container, Executor> a, Launcher launch) {
+  using etype = typename Container::value_type;
+  a.results.emplace_back(name);
+  TestResultEntry &result = a.results.back();
+  {
+    auto m_a_gpu = blas::make_sycl_iterator_buffer<etype>(
+        const_cast<etype *>(a.a.data()), a.a.size());
+    auto v_x_gpu = blas::make_sycl_iterator_buffer<etype>(
+        const_cast<etype *>(a.x.data()), a.x.size());
+    auto v_y_gpu = blas::make_sycl_iterator_buffer<etype>(
+        const_cast<etype *>(a.y.data()), a.y.size());
+    run_tune(r, 2.0 * a.m * a.n, result, [&] {
+      auto event = launch(a.ex, m_a_gpu, v_x_gpu, v_y_gpu);
+      a.ex.get_policy_handler().wait(event);
+    });
+  }
+  result.error = relative_diff(a.refY, a.y);
+}
+
+template <typename E>
+void run_tune_gemv(int seed, char trans, int m, int n, int rep) {
+  std::cout << std::scientific;
+
+  std::mt19937 rnd(seed);
+
+  const bool is_normal = (trans == 'n' || trans == 'N');
+  const int x_size = is_normal ? n : m;
+  const int y_size = is_normal ? m : n;
+  const int lda = m;
+
+  auto dataA = gen_matrix<E>(m * n, -1, 1, rnd);
+  auto dataX = gen_matrix<E>(x_size, -1, 1, rnd);
+  auto origY = gen_matrix<E>(y_size, -1, 1, rnd);
+  auto refY = origY;
+
+  // beta is zero so that repeated launches all produce the same result
+  const E alpha(1);
+  const E beta(0);
+
+  TestResult results{};
+
+  const char t_str[] = {trans, '\0'};
+  results.emplace_back("System GEMV implementation");
+  TestResultEntry &ref_result = results.back();
+  run_tune(rep, 2.0 * m * n, ref_result, [&] {
+    reference_gemv::gemv(t_str, m, n, alpha, dataA.data(), lda, dataX.data(),
+                         1, beta, refY.data(), 1);
+  });
+  ref_result.error = 0.0;
+
+  cl::sycl::queue q([=](cl::sycl::exception_list eL) {
+    try {
+      for (auto &e : eL) {
+        std::rethrow_exception(e);
+      }
+    } catch (cl::sycl::exception &e) {
+      std::cout << " E " << e.what() << std::endl;
+    } catch (...) {
+      std::cout << " An exception " << std::endl;
+    }
+  });
+  std::cout << "\nDevice: "
+            << q.get_device().get_info<cl::sycl::info::device::name>()
+            << std::endl;
+
+  Executor<PolicyHandler<codeplay_policy>> ex(q);
+
+  GemvArgs<E, decltype(dataA), decltype(ex)> args{
+      trans, m, n, alpha, dataA, lda, dataX, beta, origY, refY, ex, results};
+
+  tune_gemv(rep, "SYCL-BLAS gemv", args,
+            [&](decltype(ex) &ex, BufferIterator<E, codeplay_policy> a,
+                BufferIterator<E, codeplay_policy> x,
+                BufferIterator<E, codeplay_policy> y) {
+              return blas::internal::_gemv(ex, trans, m, n, alpha, a, lda, x,
+                                           1, beta, y, 1);
+            });
+
+  for (int local : {32, 64, 128, 256}) {
+    std::ostringstream name;
+    name << "single_pass local=" << local;
+    tune_gemv(rep, name.str(), args,
+              [&](decltype(ex) &ex, BufferIterator<E, codeplay_policy> a,
+                  BufferIterator<E, codeplay_policy> x,
+                  BufferIterator<E, codeplay_policy> y) {
+                return blas::internal::_gemv_single_pass_impl(
+                    ex, Transposition(trans), m, n, alpha, a, lda, x, 1, beta,
+                    y, 1, local);
+              });
+  }
+
+  for (int local : {32, 64, 128, 256}) {
+    for (int cols_wg : {0, 256, 1024, 4096}) {
+      std::ostringstream name;
+      name << "two_pass local=" << local << " cols_per_wg=" << cols_wg;
+      tune_gemv(rep, name.str(), args,
+                [&](decltype(ex) &ex, BufferIterator<E, codeplay_policy> a,
+                    BufferIterator<E, codeplay_policy> x,
+                    BufferIterator<E, codeplay_policy> y) {
+                  return blas::internal::_gemv_impl(
+                      ex, Transposition(trans), m, n, alpha, a, lda, x, 1,
+                      beta, y, 1, local, local, 1, cols_wg);
+                });
+    }
+  }
+
+  std::sort(results.begin(), results.end());
+  results.print_all();
+}